@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2020, 2022, Huawei Technologies Co., Ltd. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -2720,6 +2720,114 @@ void C2_MacroAssembler::arrays_equals_v(Register a1, Register a2, Register resul
   BLOCK_COMMENT("} arrays_equals_v");
 }
 
+// jdk.internal.util.ArraysSupport.vectorizedHashCode
+// Chunks of VLMAX elements are folded into the result with
+//   result = 31^VLMAX * result + sum(ary[i + j] * 31^(VLMAX - 1 - j)),
+// the remaining elements are handled by the scalar arrays_hashcode.
+//
+// v1 - v7 are clobbered.
+void C2_MacroAssembler::arrays_hashcode_v(Register ary, Register cnt, Register result,
+                                          Register tmp1, Register tmp2, Register tmp3,
+                                          Register tmp4, Register tmp5, Register tmp6,
+                                          BasicType eltype)
+{
+  assert_different_registers(ary, cnt, result, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, t0, t1);
+
+  const int elsize = arrays_hashcode_elsize(eltype);
+  const Register vlmax = tmp1;
+  const Register pow31_vlmax = tmp2;
+  const Register chunk_bytes = tmp3;
+  const Register pow31 = tmp4;
+  const VectorRegister vsum = v1;
+  const VectorRegister vdata = v2;
+  const VectorRegister vpow = v4;
+  const VectorRegister vtmp = v6;
+
+  Label TAIL, POW_LOOP, VECTOR_LOOP;
+
+  BLOCK_COMMENT("arrays_hashcode_v {");
+
+  vsetvli(vlmax, x0, Assembler::e32, Assembler::m2);
+  blt(cnt, vlmax, TAIL);
+
+  // vpow[j] = 31^(VLMAX - 1 - j), computed by squaring and
+  // multiplying over the bits of the exponents.
+  addi(t0, vlmax, -1);
+  vid_v(vtmp);
+  vrsub_vx(vtmp, vtmp, t0);
+  vmv_v_i(vpow, 1);
+  mv(pow31, 31);
+
+  bind(POW_LOOP);
+  addiw(t1, pow31, -1);
+  vand_vi(vdata, vtmp, 1);
+  vmul_vx(vdata, vdata, t1);
+  vadd_vi(vdata, vdata, 1);      // exponent bit set ? pow31 : 1
+  vmul_vv(vpow, vpow, vdata);
+  vsrl_vi(vtmp, vtmp, 1);
+  mulw(pow31, pow31, pow31);
+  srli(t0, t0, 1);
+  bnez(t0, POW_LOOP);
+
+  vmv_x_s(pow31_vlmax, vpow);    // 31^(VLMAX - 1)
+  slli(t0, pow31_vlmax, 5);      // optimize 31 * 31^(VLMAX - 1)
+  subw(pow31_vlmax, t0, pow31_vlmax);
+  slli(chunk_bytes, vlmax, exact_log2(elsize));
+
+  bind(VECTOR_LOOP);
+  arrays_hashcode_elload_v(vdata, vtmp, ary, eltype);
+  vmul_vv(vdata, vdata, vpow);
+  vmv_s_x(vsum, zr);
+  vredsum_vs(vsum, vdata, vsum);
+  vmv_x_s(t0, vsum);
+  mulw(result, result, pow31_vlmax);
+  addw(result, result, t0);
+  add(ary, ary, chunk_bytes);
+  sub(cnt, cnt, vlmax);
+  bge(cnt, vlmax, VECTOR_LOOP);
+
+  bind(TAIL);
+  arrays_hashcode(ary, cnt, result, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, eltype);
+
+  BLOCK_COMMENT("} arrays_hashcode_v");
+}
+
+// Loads VLMAX elements at src as ints into vdst, expects the vtype to
+// be e32 and m2.
+void C2_MacroAssembler::arrays_hashcode_elload_v(VectorRegister vdst, VectorRegister vtmp,
+                                                 Register src, BasicType eltype) {
+  switch (eltype) {
+  case T_BOOLEAN:
+  case T_BYTE:
+    vsetvli(x0, x0, Assembler::e8, Assembler::mf2);
+    vle8_v(vtmp, src);
+    vsetvli(x0, x0, Assembler::e32, Assembler::m2);
+    if (eltype == T_BOOLEAN) {
+      // T_BOOLEAN used as surrogate for unsigned byte
+      vzext_vf4(vdst, vtmp);
+    } else {
+      vsext_vf4(vdst, vtmp);
+    }
+    break;
+  case T_SHORT:
+  case T_CHAR:
+    vsetvli(x0, x0, Assembler::e16, Assembler::m1);
+    vle16_v(vtmp, src);
+    vsetvli(x0, x0, Assembler::e32, Assembler::m2);
+    if (eltype == T_CHAR) {
+      vzext_vf2(vdst, vtmp);
+    } else {
+      vsext_vf2(vdst, vtmp);
+    }
+    break;
+  case T_INT:
+    vle32_v(vdst, src);
+    break;
+  default:
+    ShouldNotReachHere();
+  }
+}
+
 void C2_MacroAssembler::string_compare_v(Register str1, Register str2, Register cnt1, Register cnt2,
                                          Register result, Register tmp1, Register tmp2, int encForm) {
   Label DIFFERENCE, DONE, L, loop;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2020, 2022, Huawei Technologies Co., Ltd. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -212,6 +212,16 @@
                        Register result, Register cnt1,
                        int elem_size);
 
+  void arrays_hashcode_v(Register ary, Register cnt, Register result,
+                         Register tmp1, Register tmp2,
+                         Register tmp3, Register tmp4,
+                         Register tmp5, Register tmp6,
+                         BasicType eltype);
+
+  // helper function for arrays_hashcode_v
+  void arrays_hashcode_elload_v(VectorRegister vdst, VectorRegister vtmp,
+                                Register src, BasicType eltype);
+
   void string_compare_v(Register str1, Register str2,
                         Register cnt1, Register cnt2,
                         Register result,
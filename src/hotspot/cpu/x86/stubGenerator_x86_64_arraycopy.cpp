@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2003, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2003, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -473,6 +473,8 @@ void StubGenerator::copy_bytes_backward(Register from, Register dest,
 //   copy performs better.
 // - If user sets AVX3Threshold=0, then special cases for small blocks sizes operate over
 //   64 byte vector registers (ZMMs).
+// - With 64 byte vectors, disjoint copies of at least ArrayCopyNonTemporalThreshold bytes
+//   use non-temporal stores to avoid evicting the working set from the caches.
 
 // Inputs:
 //   c_rarg0   - source array address
@@ -532,7 +534,7 @@ address StubGenerator::generate_disjoint_copy_avx3_masked(StubGenStubId stub_id,
 
   int avx3threshold = VM_Version::avx3_threshold();
   bool use64byteVector = (MaxVectorSize > 32) && (avx3threshold == 0);
-  const int large_threshold = 2621440; // 2.5 MB
+  const int large_threshold = ArrayCopyNonTemporalThreshold;
   Label L_main_loop, L_main_loop_64bytes, L_tail, L_tail64, L_exit, L_entry;
   Label L_repmovs, L_main_pre_loop, L_main_pre_loop_64bytes, L_pre_main_post_64;
   Label L_copy_large, L_finish;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -3384,6 +3384,12 @@ void TemplateTable::invokeinterface(int byte_no) {
 
   // Preserve method for throw_AbstractMethodErrorVerbose.
   __ mov(rcx, rbx);
+  // If the method is declared in REFC, which is the common case, the itable
+  // scan for the method below also performs the receiver subtype check.
+  Label skip_refc_check;
+  __ load_method_holder(rlocals, rbx);
+  __ cmpptr(rlocals, rax);
+  __ jcc(Assembler::equal, skip_refc_check);
   // Receiver subtype check against REFC.
   // Superklass in rax. Subklass in rdx. Blows rcx, rdi.
   __ lookup_interface_method(// inputs: rec. class, interface, itable index
@@ -3392,6 +3398,7 @@ void TemplateTable::invokeinterface(int byte_no) {
                              rbcp, rlocals,
                              no_such_interface,
                              /*return_method=*/false);
+  __ bind(skip_refc_check);
 
   // profile this call
   __ restore_bcp(); // rbcp was destroyed by receiver type check
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -872,6 +872,10 @@ jlong CgroupSubsystem::cache_usage_in_bytes() {
   return memory_controller()->controller()->cache_usage_in_bytes();
 }
 
+double CgroupSubsystem::memory_pressure() {
+  return memory_controller()->controller()->memory_pressure();
+}
+
 int CgroupSubsystem::cpu_quota() {
   return cpu_controller()->controller()->cpu_quota();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -323,6 +323,12 @@ jlong CgroupV1MemoryController::cache_usage_in_bytes() {
   return cache;
 }
 
+double CgroupV1MemoryController::memory_pressure() {
+  // Pressure stall information is only available with cgroups v2
+  log_trace(os, container)("Memory Pressure is not supported.");
+  return OSCONTAINER_ERROR; // not supported
+}
+
 jlong CgroupV1MemoryController::kernel_memory_usage_in_bytes() {
   julong kmem_usage;
   CONTAINER_READ_NUMBER_CHECKED(reader(), "/memory.kmem.usage_in_bytes", "Kernel Memory Usage", kmem_usage);
@@ -199,6 +199,31 @@ jlong CgroupV2MemoryController::cache_usage_in_bytes() {
   return (jlong)cache;
 }
 
+/* memory_pressure
+ *
+ * Return the share of time in the last 10 seconds in which at least
+ * one task in this cgroup was stalled on memory, as reported by the
+ * pressure stall information in memory.pressure. The first line of the
+ * interface file has the format:
+ *
+ *   some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+ *
+ * return:
+ *    memory pressure in percent or
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV2MemoryController::memory_pressure() {
+  char buf[128];
+  double avg10;
+  if (!reader()->read_string("/memory.pressure", buf, sizeof(buf)) ||
+      sscanf(buf, "some avg10=%lf", &avg10) != 1) {
+    log_trace(os, container)("Memory Pressure failed: %d", OSCONTAINER_ERROR);
+    return OSCONTAINER_ERROR;
+  }
+  log_trace(os, container)("Memory Pressure is: %.2f%%", avg10);
+  return avg10;
+}
+
 // Note that for cgroups v2 the actual limits set for swap and
 // memory live in two different files, memory.swap.max and memory.max
 // respectively. In order to properly report a cgroup v1 like
@@ -93,6 +93,7 @@ class CgroupV2MemoryController final: public CgroupMemoryController {
     jlong memory_max_usage_in_bytes() override;
     jlong rss_usage_in_bytes() override;
     jlong cache_usage_in_bytes() override;
+    double memory_pressure() override;
     void print_version_specific_info(outputStream* st, julong host_mem) override;
     bool is_read_only() override {
       return reader()->is_read_only();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,11 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, UseTransparentHugePagesForCode, false, EXPERIMENTAL,    \
+          "Use MADV_HUGEPAGE for committed executable memory like the " \
+          "code cache if transparent huge pages are in madvise mode, "  \
+          "independent of UseLargePages")                               \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
@@ -89,6 +94,11 @@
   product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
           "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory.")         \
                                                                         \
+  product(bool, UseMadvPopulateWriteForSmallPages, false, EXPERIMENTAL, \
+          "Also use MADV_POPULATE_WRITE in os::pd_pretouch_memory "     \
+          "without transparent huge pages, populating a range with a "  \
+          "single system call instead of touching every page.")         \
+                                                                        \
   product(bool, PrintMemoryMapAtExit, false, DIAGNOSTIC,                \
           "Print an annotated memory map at exit")                      \
                                                                         \
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2023, 2024, Red Hat, Inc. and/or its affiliates.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -42,10 +42,21 @@ class ProcSmapsSummary {
   size_t _swapped_out;  // combined amount of swapped-out memory
   size_t _hugetlb;      // combined amount of memory backed by explicit huge pages
   size_t _thp;          // combined amount of memory backed by THPs
+  // THP and hugetlb usage of mappings that belong to a single NMT tag
+  size_t _hugetlb_by_tag[mt_number_of_tags];
+  size_t _thp_by_tag[mt_number_of_tags];
 public:
   ProcSmapsSummary() : _num_mappings(0), _vsize(0), _rss(0), _committed(0), _shared(0),
-                     _swapped_out(0), _hugetlb(0), _thp(0) {}
-  void add_mapping(const ProcSmapsInfo& info) {
+                     _swapped_out(0), _hugetlb(0), _thp(0), _hugetlb_by_tag(), _thp_by_tag() {}
+  void add_mapping(const ProcSmapsInfo& info, const MappingPrintSession& session) {
+    const size_t hugetlb = info.private_hugetlb + info.shared_hugetlb;
+    if (hugetlb > 0 || info.anonhugepages > 0) {
+      const MemTag mem_tag = session.single_mem_tag_for_region(info.from, info.to);
+      if (mem_tag != mtNone) {
+        _hugetlb_by_tag[(int)mem_tag] += hugetlb;
+        _thp_by_tag[(int)mem_tag] += info.anonhugepages;
+      }
+    }
     _num_mappings++;
     _vsize += info.vsize();
     _rss += info.rss;
@@ -66,6 +77,19 @@ class ProcSmapsSummary {
     st->print_cr("       swapped out: %zu (" PROPERFMT ")", _swapped_out, PROPERFMTARGS(_swapped_out));
     st->print_cr("         using thp: %zu (" PROPERFMT ")", _thp, PROPERFMTARGS(_thp));
     st->print_cr("           hugetlb: %zu (" PROPERFMT ")", _hugetlb, PROPERFMTARGS(_hugetlb));
+    bool header_printed = false;
+    for (int i = 0; i < mt_number_of_tags; i++) {
+      if (_thp_by_tag[i] == 0 && _hugetlb_by_tag[i] == 0) {
+        continue;
+      }
+      if (!header_printed) {
+        st->print_cr("Huge pages by vm info (mappings with a single NMT tag):");
+        header_printed = true;
+      }
+      st->print_cr("%18s: thp " PROPERFMT ", hugetlb " PROPERFMT,
+                   MappingPrintSession::mem_tag_shortname((MemTag)i),
+                   PROPERFMTARGS(_thp_by_tag[i]), PROPERFMTARGS(_hugetlb_by_tag[i]));
+    }
   }
 };
 
@@ -177,7 +201,7 @@ void MemMapPrinter::pd_print_all_mappings(const MappingPrintSession& session) {
   ProcSmapsParser parser(f);
   while (parser.parse_next(info)) {
     printer.print_single_mapping(info);
-    summary.add_mapping(info);
+    summary.add_mapping(info, session);
   }
   st->cr();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -58,6 +58,7 @@ class OSContainer: AllStatic {
   static jlong memory_max_usage_in_bytes();
   static jlong rss_usage_in_bytes();
   static jlong cache_usage_in_bytes();
+  static double memory_pressure();
 
   static int active_processor_count();
 
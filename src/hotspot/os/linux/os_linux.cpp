@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2015, 2024 SAP SE. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -1254,6 +1254,15 @@ bool os::is_primordial_thread(void) {
   }
 }
 
+bool os::Linux::current_thread_has_vm_created_stack() {
+  if (os::is_primordial_thread()) {
+    return false;
+  }
+  Thread* thread = Thread::current_or_null();
+  return thread != nullptr &&
+         !(thread->is_Java_thread() && JavaThread::cast(thread)->has_attached_via_jni());
+}
+
 // Find the virtual memory area that contains addr
 static bool find_vma(address addr, address* vma_low, address* vma_high) {
   FILE *fp = os::fopen("/proc/self/maps", "r");
@@ -2906,6 +2915,10 @@ int os::Linux::commit_memory_impl(char* addr, size_t size, bool exec) {
     if (UseNUMAInterleaving) {
       numa_make_global(addr, size);
     }
+    if (exec && UseTransparentHugePagesForCode && HugePages::thp_mode() == THPMode::madvise) {
+      // Executable memory is the code cache, back it with THPs to reduce iTLB misses
+      madvise_transparent_huge_pages(addr, size);
+    }
     return 0;
   } else {
     ErrnoPreserver ep;
@@ -3047,6 +3060,18 @@ size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
     }
     return 0;
   }
+  if (UseMadvPopulateWrite && UseMadvPopulateWriteForSmallPages) {
+    if (::madvise(first, len, MADV_POPULATE_WRITE) == 0) {
+      return 0;
+    }
+    // Fall back to touching every page, which also handles memory the
+    // kernel refuses to populate, e.g. because of a mapping it does not
+    // support.
+    int err = errno;
+    log_debug(gc, os)("::madvise(" PTR_FORMAT ", %zu, %d) failed; "
+                      "error='%s' (errno=%d)", p2i(first), len,
+                      MADV_POPULATE_WRITE, os::strerror(err), err);
+  }
   return page_size;
 }
 
@@ -4316,6 +4341,23 @@ jlong os::Linux::sendfile(int out_fd, int in_fd, jlong* offset, jlong count) {
   return ::sendfile(out_fd, in_fd, (off_t*)offset, (size_t)count);
 }
 
+// Like sendfile, but lets the file system share extents or do a server-side
+// copy. Writes at the current file offset of out_fd. Returns -1 with errno
+// set to ENOSYS if the kernel or the headers do not provide copy_file_range.
+jlong os::Linux::copy_file_range(int in_fd, jlong* in_offset, int out_fd, jlong count) {
+#ifdef SYS_copy_file_range
+  loff_t off = (loff_t)*in_offset;
+  const long ret = syscall(SYS_copy_file_range, in_fd, &off, out_fd, nullptr, (size_t)count, 0u);
+  if (ret > 0) {
+    *in_offset = (jlong)off;
+  }
+  return ret;
+#else
+  errno = ENOSYS;
+  return -1;
+#endif
+}
+
 // Determine if the vmid is the parent pid for a child in a PID namespace.
 // Return the namespace pid if so, otherwise -1.
 int os::Linux::get_namespace_pid(int vmid) {
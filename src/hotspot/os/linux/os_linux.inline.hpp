@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,9 +38,14 @@ inline bool os::uses_stack_guard_pages() {
   return true;
 }
 
+// Stacks of threads started by the VM are fully mapped by pthread_create(), so
+// protecting and unprotecting the guard zone in place saves an mmap per thread
+// start and exit, and leaves the stack as glibc expects it when it caches the
+// stack for reuse. The primordial thread and threads attached through JNI may
+// run on stacks the VM did not create, so they still commit the guard zone.
 inline bool os::must_commit_stack_guard_pages() {
   assert(uses_stack_guard_pages(), "sanity check");
-  return true;
+  return !os::Linux::current_thread_has_vm_created_stack();
 }
 
 // Bang the shadow pages if they need to be touched to be mapped.
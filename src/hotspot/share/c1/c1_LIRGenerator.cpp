@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -2471,6 +2471,7 @@ ciKlass* LIRGenerator::profile_type(ciMethodData* md, int md_base_offset, int md
     return result;
   }
 
+  begin_type_profile_sample();
   if (mdp == LIR_OprFact::illegalOpr) {
     mdp = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), mdp);
@@ -2487,6 +2488,45 @@ ciKlass* LIRGenerator::profile_type(ciMethodData* md, int md_base_offset, int md
   return result;
 }
 
+// With C1TypeProfileSampleFreqLog, the type profile updates emitted by
+// profile_type() are only executed with a probability of 1/2^n. Each
+// profiling point advances a per-thread xorshift generator and skips the
+// updates unless the low n bits of the new value are zero. A plain counter
+// would alias with call patterns that repeat with the same period, so some
+// profiling points would never be sampled. The check is emitted lazily
+// before the first update of a profiling point so nothing is emitted if no
+// update is needed, and end_type_profile_sample() binds the label that
+// skips the updates. The skipped code must not define any operand that is
+// used later on, so the profiled values must have been evaluated before.
+void LIRGenerator::begin_type_profile_sample() {
+  if (C1TypeProfileSampleFreqLog == 0 || _type_profile_sample_skip != nullptr) {
+    return;
+  }
+  _type_profile_sample_skip = new LabelObj();
+  LIR_Address* seed_addr = new LIR_Address(getThreadPointer(), in_bytes(JavaThread::profile_sample_seed_offset()), T_INT);
+  LIR_Opr seed = new_register(T_INT);
+  LIR_Opr tmp = new_register(T_INT);
+  __ load(seed_addr, seed);
+  __ shift_left(seed, 13, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ unsigned_shift_right(seed, 17, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ shift_left(seed, 5, tmp);
+  __ logical_xor(seed, tmp, seed);
+  __ store(seed, seed_addr);
+  LIR_Opr mask = load_immediate(right_n_bits(C1TypeProfileSampleFreqLog), T_INT);
+  __ logical_and(seed, mask, tmp);
+  __ cmp(lir_cond_notEqual, tmp, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_notEqual, _type_profile_sample_skip->label());
+}
+
+void LIRGenerator::end_type_profile_sample() {
+  if (_type_profile_sample_skip != nullptr) {
+    __ branch_destination(_type_profile_sample_skip->label());
+    _type_profile_sample_skip = nullptr;
+  }
+}
+
 // profile parameters on entry to the root of the compilation
 void LIRGenerator::profile_parameters(Base* x) {
   if (compilation()->profile_parameters()) {
@@ -2516,6 +2556,7 @@ void LIRGenerator::profile_parameters(Base* x) {
         }
         java_index += type2size[t];
       }
+      end_type_profile_sample();
     }
   }
 }
@@ -3061,6 +3102,17 @@ void LIRGenerator::do_ProfileCall(ProfileCall* x) {
   // tmp is used to hold the counters on SPARC
   LIR_Opr tmp = new_pointer_register();
 
+  if (C1TypeProfileSampleFreqLog > 0) {
+    // The type profile updates may be skipped: evaluate the profiled
+    // values outside of the skipped code.
+    if (x->recv() != nullptr) {
+      walk(x->recv());
+    }
+    for (int i = 0; i < x->nb_profiled_args(); i++) {
+      walk(x->profiled_arg_at(i));
+    }
+  }
+
   if (x->nb_profiled_args() > 0) {
     profile_arguments(x);
   }
@@ -3069,6 +3121,7 @@ void LIRGenerator::do_ProfileCall(ProfileCall* x) {
   if (x->recv() != nullptr || x->nb_profiled_args() > 0) {
     profile_parameters_at_call(x);
   }
+  end_type_profile_sample();
 
   if (x->recv() != nullptr) {
     LIRItem value(x->recv(), this);
@@ -3104,6 +3157,7 @@ void LIRGenerator::do_ProfileReturnType(ProfileReturnType* x) {
     if (exact != nullptr) {
       md->set_return_type(bci, exact);
     }
+    end_type_profile_sample();
   }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -741,6 +741,14 @@ void LinearScan::compute_global_live_sets() {
   int  iteration_count = 0;
   ResourceBitMap live_out(live_set_size()); // scratch set for calculations
 
+  // live_out of a block only has to be recomputed when the live_in set of one of
+  // its successors has changed since the block was visited last. Record when the
+  // sets were last computed to avoid the bitmap operations for the unchanged
+  // parts of the method, which dominate for large methods with many registers.
+  int step = 0;
+  intArray live_in_step(num_blocks, num_blocks, -1);  // step at which live_in was last computed
+  intArray live_out_step(num_blocks, num_blocks, -1); // step at which live_out was last computed
+
   // Perform a backward dataflow analysis to compute live_out and live_in for each block.
   // The loop is executed until a fixpoint is reached (no changes in an iteration)
   // Exception handlers must be processed because not all live values are
@@ -757,7 +765,16 @@ void LinearScan::compute_global_live_sets() {
       // live_out(block) is the union of live_in(sux), for successors sux of block
       int n = block->number_of_sux();
       int e = block->number_of_exception_handlers();
-      if (n + e > 0) {
+      bool sux_changed = iteration_count == 0;
+      for (int j = 0; j < n && !sux_changed; j++) {
+        sux_changed = live_in_step.at(block->sux_at(j)->linear_scan_number()) > live_out_step.at(i);
+      }
+      for (int j = 0; j < e && !sux_changed; j++) {
+        sux_changed = live_in_step.at(block->exception_handler_at(j)->linear_scan_number()) > live_out_step.at(i);
+      }
+      live_out_step.at_put(i, step++);
+
+      if (n + e > 0 && sux_changed) {
         // block has successors
         if (n > 0) {
           live_out.set_from(block->sux_at(0)->live_in());
@@ -789,6 +806,7 @@ void LinearScan::compute_global_live_sets() {
         live_in.set_from(block->live_out());
         live_in.set_difference(block->live_kill());
         live_in.set_union(block->live_gen());
+        live_in_step.at_put(i, step++);
       }
 
 #ifdef ASSERT
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2000, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -308,6 +308,13 @@
   product(bool, C1UpdateMethodData, true,                                   \
           "Update MethodData*s in Tier 3 C1 generated code")                \
                                                                             \
+  product(int, C1TypeProfileSampleFreqLog, 0, EXPERIMENTAL,                 \
+          "Only update argument, parameter and return type profiles in "    \
+          "Tier 3 C1 generated code with a probability of 1/2^n, drawn "    \
+          "from a per-thread pseudo-random sequence. 0 updates the "        \
+          "profiles on every call")                                         \
+          range(0, 16)                                                      \
+                                                                            \
   develop(bool, PrintCFGToFile, false,                                      \
           "print control flow graph to a separate file during compilation")
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2022, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -538,6 +538,11 @@ bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp,
     return true;
   }
 
+  if (log_is_enabled(Debug, aot, resolve)) {
+    ResourceMark rm;
+    log_debug(aot, resolve)("Unsupported indy bootstrap method [%d]: %s.%s", cp_index,
+                            bsm_klass->as_C_string(), bsm_name->as_C_string());
+  }
   return false;
 }
 #ifdef ASSERT
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2003, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2003, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1387,6 +1387,7 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
     SharedDataRelocator ro_patcher((address*)ro_patch_base + header()->ro_ptrmap_start_pos(), (address*)ro_patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
 
+    jlong start = os::javaTimeNanos();
     if (AOTCacheParallelRelocation) {
       ArchiveWorkers workers;
       SharedDataRelocationTask task(&rw_ptrmap, &ro_ptrmap, &rw_patcher, &ro_patcher);
@@ -1398,7 +1399,9 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
-    aot_log_debug(aot, reloc)("runtime archive relocation done");
+    aot_log_debug(aot, reloc)("runtime archive relocation done (%.3f ms, %s)",
+                              (double)(os::javaTimeNanos() - start) / NANOSECS_PER_MILLISEC,
+                              AOTCacheParallelRelocation ? "parallel" : "serial");
     return true;
   }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -150,11 +150,16 @@ uint32_t AltHashing::halfsiphash_32(uint64_t seed, const void* in, int len) {
   // body
   while (count >= 4) {
 
+#ifdef VM_LITTLE_ENDIAN
+    // A single unaligned load assembles the same value as the bytes below.
+    memcpy(&newdata, data + off, sizeof(newdata));
+#else
     // Avoid sign extension with 0x0ff
     newdata = (data[off] & 0x0FF)
         | (data[off + 1] & 0x0FF) << 8
         | (data[off + 2] & 0x0FF) << 16
         | data[off + 3] << 24;
+#endif
 
     count -= 4;
     off += 4;
@@ -196,9 +201,15 @@ uint32_t AltHashing::halfsiphash_32(uint64_t seed, const uint16_t* data, int len
 
   // body
   while (count >= 2) {
+#ifdef VM_LITTLE_ENDIAN
+    // A single unaligned load assembles the same value as the two chars below.
+    memcpy(&newdata, data + off, sizeof(newdata));
+    off += 2;
+#else
     uint16_t d1 = data[off++] & 0x0FFFF;
     uint16_t d2 = data[off++];
     newdata = (d1 | d2 << 16);
+#endif
 
     count -= 2;
 
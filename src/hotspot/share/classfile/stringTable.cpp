@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -559,6 +559,7 @@ oop StringTable::do_intern(const StringWrapper& name, uintx hash, TRAPS) {
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
     if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      check_concurrent_work();
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
@@ -658,6 +659,19 @@ void StringTable::gc_notification(size_t num_dead) {
   }
 }
 
+// Growing is otherwise only considered from the GC notification, so a
+// burst of interning between GCs could run with long chains until the
+// next GC. Check the load factor on insert to start growing earlier.
+void StringTable::check_concurrent_work() {
+  if (has_work()) {
+    return;
+  }
+  if (should_grow()) {
+    log_debug(stringtable)("Concurrent work triggered, live factor: %g", get_load_factor());
+    trigger_concurrent_work();
+  }
+}
+
 bool StringTable::should_grow() {
   return get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -103,6 +103,7 @@ class StringTable : AllStatic {
   // Rehash the string table if it gets out of balance
 private:
   static bool should_grow();
+  static void check_concurrent_work();
   static bool maybe_rehash_table();
 public:
   static void rehash_table();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,13 @@
  * during application training run.
  * In following "production" runs this code and data can be loaded into
  * Code Cache skipping its generation.
+ *
+ * Only code which does not depend on the loaded classes is cached: stubs,
+ * runtime blobs and i2c2i adapters. Compiled Java methods (nmethods) are
+ * not cached, since their oops, metadata and dependencies would have to be
+ * relocated and revalidated at load time. Instead, the profiles and compile
+ * records of the training run (see TrainingData) are replayed to recompile
+ * the hot methods early, see AOTCompileEagerly and SkipTier2IfPossible.
  */
 
 class CodeBuffer;
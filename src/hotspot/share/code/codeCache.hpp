@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,6 +64,16 @@
 // code cache segmentation is turned on if tiered mode is enabled and
 // ReservedCodeCacheSize >= 240 MB.
 //
+// The heaps segregate code by type, not by how hot it is. There is no
+// separate heap for hot nmethods: C2 code does not maintain invocation
+// counters to pick them, and nmethods cannot be moved to another heap once
+// they are installed. Fully optimized code already shares the non-profiled
+// heap with only level 1 code. With UseLargePages the whole reserved code
+// cache, all heaps included, is mapped with the largest page size of which
+// it holds at least eight pages (see CodeCache::initialize_heaps(..)). A
+// single code heap with InitialCodeCacheSize == ReservedCodeCacheSize only
+// needs to hold one such page (see CodeCache::initialize()).
+//
 // All methods of the CodeCache accepting a CodeBlobType only apply to
 // CodeBlobs of the given type. For example, iteration over the
 // CodeBlobs of a specific type can be done by using CodeCache::first_blob(..)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -158,6 +158,20 @@ void CompilationPolicy::replay_training_at_init_impl(InstanceKlass* klass, TRAPS
             }
           }
         });
+        // Top-level compilations without any initialization dependencies are not
+        // found through the dependencies of a class. Compile the methods of this
+        // class early if their recorded C2 compilation has no pending dependencies.
+        Array<Method*>* methods = klass->methods();
+        for (int i = 0; i < methods->length(); i++) {
+          const methodHandle mh(THREAD, methods->at(i));
+          MethodTrainingData* mtd = MethodTrainingData::find_fast(mh);
+          if (mtd != nullptr) {
+            CompileTrainingData* ctd = mtd->last_toplevel_compile(CompLevel_full_optimization);
+            if (ctd != nullptr && ctd->init_deps_left() == 0) {
+              CompilationPolicy::maybe_compile_early(mh, THREAD);
+            }
+          }
+        }
       }
     }
   }
@@ -738,6 +752,16 @@ void CompilationPolicy::handle_counter_overflow(const methodHandle& method) {
   }
 }
 
+// The task following next_task in select_task(). A bounded scan wraps around
+// at the end of the queue. The queue is read after the current task has been
+// removed, so a wrapped scan never continues with a removed task.
+static CompileTask* next_scanned_task(CompileQueue* compile_queue, CompileTask* next_task, bool bounded) {
+  if (next_task == nullptr && bounded) {
+    return compile_queue->first();
+  }
+  return next_task;
+}
+
 // Called with the queue locked and with at least one element
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThread* THREAD) {
   CompileTask *max_blocking_task = nullptr;
@@ -745,14 +769,27 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
   Method* max_method = nullptr;
 
   int64_t t = nanos_to_millis(os::javaTimeNanos());
+  // With TieredCompileTaskScanLimit, only examine a window of the queue that
+  // starts where the previous selection stopped and wraps around at the end of
+  // the queue. This bounds the cost of a selection with a long queue, while
+  // every task is still eventually considered and pruned when stale. If all
+  // tasks in the window were stale, keep scanning until a live task is found,
+  // so that nothing is returned only when the queue has been emptied.
+  const bool bounded = TieredCompileTaskScanLimit > 0;
+  CompileTask* task = bounded ? compile_queue->scan_start() : nullptr;
+  if (task == nullptr) {
+    task = compile_queue->first();
+  }
   // Iterate through the queue and find a method with a maximum rate.
-  for (CompileTask* task = compile_queue->first(); task != nullptr;) {
+  for (intx scanned = 0; task != nullptr &&
+       (!bounded || max_task == nullptr ||
+        (scanned < TieredCompileTaskScanLimit && scanned < compile_queue->size())); scanned++) {
     CompileTask* next_task = task->next();
     // If a method was unloaded or has been stale for some time, remove it from the queue.
     // Blocking tasks and tasks submitted from whitebox API don't become stale
     if (task->is_unloaded()) {
       compile_queue->remove_and_mark_stale(task);
-      task = next_task;
+      task = next_scanned_task(compile_queue, next_task, bounded);
       continue;
     }
     if (task->is_blocking() && task->compile_reason() == CompileTask::Reason_Whitebox) {
@@ -768,7 +805,7 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
       }
       method->clear_queued_for_compilation();
       compile_queue->remove_and_mark_stale(task);
-      task = next_task;
+      task = next_scanned_task(compile_queue, next_task, bounded);
       continue;
     }
     update_rate(t, mh);
@@ -784,7 +821,10 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
       }
     }
 
-    task = next_task;
+    task = next_scanned_task(compile_queue, next_task, bounded);
+  }
+  if (bounded) {
+    compile_queue->set_scan_start(task);
   }
 
   if (max_blocking_task != nullptr) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -394,6 +394,7 @@ void CompileQueue::free_all() {
   }
   _first = nullptr;
   _last = nullptr;
+  _scan_start = nullptr;
 
   // Wake up all threads that block on the queue.
   MethodCompileQueue_lock->notify_all();
@@ -462,6 +463,7 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
     save_method = methodHandle(thread, task->method());
 
     remove(task);
+    Atomic::store(&_last_queue_delay, os::elapsed_counter() - task->time_queued());
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
   return task;
@@ -492,6 +494,9 @@ void CompileQueue::purge_stale_tasks() {
 
 void CompileQueue::remove(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  if (task == _scan_start) {
+    _scan_start = task->next();
+  }
   if (task->prev() != nullptr) {
     task->prev()->set_next(task->next());
   } else {
@@ -1040,20 +1045,41 @@ void CompileBroker::init_training_replay() {
   }
 }
 
+// Has the task last taken from the queue waited for at least CompilerThreadsAddQueueDelay?
+bool CompileBroker::is_queue_delayed(CompileQueue* queue) {
+  return TimeHelper::counter_to_millis(queue->last_queue_delay()) >= (double)CompilerThreadsAddQueueDelay;
+}
+
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   int old_c2_count = 0, new_c2_count = 0, old_c1_count = 0, new_c1_count = 0;
+  int max_c2_count = _c2_count, max_c1_count = _c1_count;
   const int c2_tasks_per_thread = 2, c1_tasks_per_thread = 4;
 
+  if (CompilerThreadsAddQueueDelay > 0) {
+    // Only add threads for a queue if tasks actually wait in it, and never more
+    // threads per compiler than there are processors currently available to us,
+    // which follows the CPU quota in containers.
+    int active_processors = os::active_processor_count();
+    if (_c2_compile_queue != nullptr) {
+      int c2_count = get_c2_thread_count();
+      max_c2_count = is_queue_delayed(_c2_compile_queue) ? MIN2(max_c2_count, MAX2(c2_count, active_processors)) : c2_count;
+    }
+    if (_c1_compile_queue != nullptr) {
+      int c1_count = get_c1_thread_count();
+      max_c1_count = is_queue_delayed(_c1_compile_queue) ? MIN2(max_c1_count, MAX2(c1_count, active_processors)) : c1_count;
+    }
+  }
+
   // Quick check if we already have enough compiler threads without taking the lock.
   // Numbers may change concurrently, so we read them again after we have the lock.
   if (_c2_compile_queue != nullptr) {
     old_c2_count = get_c2_thread_count();
-    new_c2_count = MIN2(_c2_count, _c2_compile_queue->size() / c2_tasks_per_thread);
+    new_c2_count = MIN2(max_c2_count, _c2_compile_queue->size() / c2_tasks_per_thread);
   }
   if (_c1_compile_queue != nullptr) {
     old_c1_count = get_c1_thread_count();
-    new_c1_count = MIN2(_c1_count, _c1_compile_queue->size() / c1_tasks_per_thread);
+    new_c1_count = MIN2(max_c1_count, _c1_compile_queue->size() / c1_tasks_per_thread);
   }
   if (new_c2_count <= old_c2_count && new_c1_count <= old_c1_count) return;
 
@@ -1068,7 +1094,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c2_compile_queue != nullptr) {
     old_c2_count = get_c2_thread_count();
-    new_c2_count = MIN4(_c2_count,
+    new_c2_count = MIN4(max_c2_count,
         _c2_compile_queue->size() / c2_tasks_per_thread,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
@@ -1129,7 +1155,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != nullptr) {
     old_c1_count = get_c1_thread_count();
-    new_c1_count = MIN4(_c1_count,
+    new_c1_count = MIN4(max_c1_count,
         _c1_compile_queue->size() / c1_tasks_per_thread,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -103,6 +103,12 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   CompileTask* _first_stale;
 
+  // Task at which the next bounded selection scan starts, see TieredCompileTaskScanLimit
+  CompileTask* _scan_start;
+
+  // Time in counter ticks that the task last taken from the queue was waiting
+  volatile jlong _last_queue_delay;
+
   volatile int _size;
   int _peak_size;
   uint _total_added;
@@ -119,6 +125,8 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _total_removed = 0;
     _peak_size = 0;
     _first_stale = nullptr;
+    _scan_start = nullptr;
+    _last_queue_delay = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -129,10 +137,14 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* first()                           { return _first; }
   CompileTask* last()                            { return _last;  }
 
+  CompileTask* scan_start()                      { return _scan_start; }
+  void         set_scan_start(CompileTask* task) { _scan_start = task; }
+
   CompileTask* get(CompilerThread* thread);
 
   bool         is_empty() const                  { return _first == nullptr; }
   int          size()     const                  { return _size;          }
+  jlong        last_queue_delay() const          { return Atomic::load(&_last_queue_delay); }
 
   int         get_peak_size()     const          { return _peak_size; }
   uint        get_total_added()   const          { return _total_added; }
@@ -261,6 +273,7 @@ class CompileBroker: AllStatic {
   static JavaThread* make_thread(ThreadType type, jobject thread_oop, CompileQueue* queue, AbstractCompiler* comp, JavaThread* THREAD);
   static void init_compiler_threads();
   static void init_training_replay();
+  static bool is_queue_delayed(CompileQueue* queue);
   static void possibly_add_compiler_threads(JavaThread* THREAD);
   static bool compilation_is_prohibited(const methodHandle& method, int osr_bci, int comp_level, bool excluded);
 
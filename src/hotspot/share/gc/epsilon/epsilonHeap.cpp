@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2017, 2022, Red Hat, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -29,6 +29,7 @@
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/spaceDecorator.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
@@ -37,6 +38,7 @@
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/ostream.hpp"
 
 jint EpsilonHeap::initialize() {
@@ -294,6 +296,46 @@ void EpsilonHeap::do_full_collection(bool clear_all_soft_refs) {
   collect(gc_cause());
 }
 
+bool EpsilonHeap::checkpoint_arena() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+  if (!EpsilonArenaReset) {
+    return false;
+  }
+
+  // Retire all TLABs, so that every later allocation is above the checkpoint
+  ensure_parsability(true);
+  _arena_checkpoint = _space->top();
+
+  log_info(gc)("Arena checkpoint at " PTR_FORMAT ", %zu%s used",
+               p2i(_arena_checkpoint),
+               byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+  return true;
+}
+
+bool EpsilonHeap::reset_arena_to_checkpoint() {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+  if (!EpsilonArenaReset || _arena_checkpoint == nullptr) {
+    return false;
+  }
+
+  // Retire all TLABs, so that no thread keeps allocating in the discarded memory
+  ensure_parsability(true);
+
+  HeapWord* const top = _space->top();
+  assert(_arena_checkpoint <= top, "Heap top should not go below the checkpoint");
+  const size_t discarded = pointer_delta(top, _arena_checkpoint, 1);
+  if (ZapUnusedHeapArea) {
+    SpaceMangler::mangle_region(MemRegion(_arena_checkpoint, top));
+  }
+  _space->set_top(_arena_checkpoint);
+
+  log_info(gc)("Arena reset to " PTR_FORMAT ", %zu%s discarded",
+               p2i(_arena_checkpoint),
+               byte_size_in_proper_unit(discarded), proper_unit_for_byte_size(discarded));
+  _monitoring_support->update_counters();
+  return true;
+}
+
 void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2017, 2022, Red Hat, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -48,13 +48,15 @@ class EpsilonHeap : public CollectedHeap {
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  HeapWord* _arena_checkpoint;
 
 public:
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap"),
-          _space(nullptr) {};
+          _space(nullptr),
+          _arena_checkpoint(nullptr) {};
 
   Name kind() const override {
     return CollectedHeap::Epsilon;
@@ -126,6 +128,12 @@ class EpsilonHeap : public CollectedHeap {
   bool can_load_archived_objects() const override { return true; }
   HeapWord* allocate_loaded_archive_space(size_t size) override;
 
+  // Arena support, see EpsilonArenaReset. Record the current top of the heap,
+  // or discard all objects allocated after the recorded top. Both must be
+  // called at a safepoint, and return false if arena reset is not enabled.
+  bool checkpoint_arena();
+  bool reset_arena_to_checkpoint();
+
   void print_heap_on(outputStream* st) const override;
   void print_gc_on(outputStream* st) const override {}
   void print_tracing_info() const override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2017, 2018, Red Hat, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -85,7 +85,14 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonArenaReset, false, EXPERIMENTAL,                     \
+          "Allow checkpointing the heap and discarding all objects "        \
+          "allocated after the checkpoint. The application must guarantee " \
+          "that no reference to those objects remains, including the ones " \
+          "the VM itself keeps, e.g. for interned strings or classes "      \
+          "loaded after the checkpoint.")
 
 // end of GC_EPSILON_FLAGS
 
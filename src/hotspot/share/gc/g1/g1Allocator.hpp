@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,7 +46,8 @@ class G1Allocator : public CHeapObj<mtGC> {
   bool _survivor_is_full;
   bool _old_is_full;
 
-  // The number of MutatorAllocRegions used, one per memory node.
+  // The number of MutatorAllocRegions, SurvivorGCAllocRegions and
+  // OldGCAllocRegions used, one of each per memory node.
   size_t _num_alloc_regions;
 
   // Alloc region used to satisfy mutator allocation requests.
@@ -58,9 +59,11 @@ class G1Allocator : public CHeapObj<mtGC> {
 
   // Alloc region used to satisfy allocation requests by the GC for
   // old objects.
-  OldGCAllocRegion _old_gc_alloc_region;
+  OldGCAllocRegion* _old_gc_alloc_regions;
 
-  G1HeapRegion* _retained_old_gc_alloc_region;
+  // The old GC alloc regions retained from the previous GC, one per memory
+  // node, to be reused at the start of the next GC.
+  G1HeapRegion** _retained_old_gc_alloc_regions;
 
   bool survivor_is_full() const;
   bool old_is_full() const;
@@ -68,14 +71,15 @@ class G1Allocator : public CHeapObj<mtGC> {
   void set_survivor_full();
   void set_old_full();
 
-  void reuse_retained_old_region(G1EvacInfo* evacuation_info,
-                                 OldGCAllocRegion* old,
-                                 G1HeapRegion** retained);
+  // Returns the number of bytes used in the reused region, or zero if the
+  // retained region could not be reused.
+  size_t reuse_retained_old_region(OldGCAllocRegion* old,
+                                   G1HeapRegion** retained);
 
   // Accessors to the allocation regions.
   inline MutatorAllocRegion* mutator_alloc_region(uint node_index);
   inline SurvivorGCAllocRegion* survivor_gc_alloc_region(uint node_index);
-  inline OldGCAllocRegion* old_gc_alloc_region();
+  inline OldGCAllocRegion* old_gc_alloc_region(uint node_index);
 
   // Allocation attempt during GC for a survivor object / PLAB.
   HeapWord* survivor_attempt_allocation(uint node_index,
@@ -84,7 +88,8 @@ class G1Allocator : public CHeapObj<mtGC> {
                                         size_t* actual_word_size);
 
   // Allocation attempt during GC for an old object / PLAB.
-  HeapWord* old_attempt_allocation(size_t min_word_size,
+  HeapWord* old_attempt_allocation(uint node_index,
+                                   size_t min_word_size,
                                    size_t desired_word_size,
                                    size_t* actual_word_size);
 
@@ -190,8 +195,7 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
 
   // Returns the number of allocation buffers for the given dest.
-  // There is only 1 buffer for Old while Young may have multiple buffers depending on
-  // active NUMA nodes.
+  // Both Young and Old have one buffer per active NUMA node.
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,8 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _pending_cards_seq(TruncatedSeqLength),
     _card_rs_length_seq(TruncatedSeqLength),
     _code_root_rs_length_seq(TruncatedSeqLength),
+    _ref_proc_time_ms_seq(TruncatedSeqLength),
+    _weak_proc_time_ms_seq(TruncatedSeqLength),
     _constant_other_time_ms_seq(TruncatedSeqLength),
     _young_other_cost_per_region_ms_seq(TruncatedSeqLength),
     _non_young_other_cost_per_region_ms_seq(TruncatedSeqLength),
@@ -106,6 +108,8 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
   _cost_per_card_scan_ms_seq.set_initial(young_only_cost_per_card_scan_ms_defaults[index]);
   _card_rs_length_seq.set_initial(0);
   _code_root_rs_length_seq.set_initial(0);
+  _ref_proc_time_ms_seq.set_initial(0.0);
+  _weak_proc_time_ms_seq.set_initial(0.0);
   _cost_per_byte_copied_ms_seq.set_initial(cost_per_byte_ms_defaults[index]);
 
   _constant_other_time_ms_seq.add(constant_other_time_ms_defaults[index]);
@@ -212,6 +216,14 @@ void G1Analytics::report_constant_other_time_ms(double constant_other_time_ms) {
   _constant_other_time_ms_seq.add(constant_other_time_ms);
 }
 
+void G1Analytics::report_ref_proc_time_ms(double ref_proc_time_ms, bool for_young_only_phase) {
+  _ref_proc_time_ms_seq.add(ref_proc_time_ms, for_young_only_phase);
+}
+
+void G1Analytics::report_weak_proc_time_ms(double weak_proc_time_ms, bool for_young_only_phase) {
+  _weak_proc_time_ms_seq.add(weak_proc_time_ms, for_young_only_phase);
+}
+
 void G1Analytics::report_pending_cards(double pending_cards, bool for_young_only_phase) {
   _pending_cards_seq.add(pending_cards, for_young_only_phase);
 }
@@ -268,6 +280,14 @@ double G1Analytics::predict_constant_other_time_ms() const {
   return predict_zero_bounded(&_constant_other_time_ms_seq);
 }
 
+double G1Analytics::predict_ref_proc_time_ms(bool for_young_only_phase) const {
+  return predict_zero_bounded(&_ref_proc_time_ms_seq, for_young_only_phase);
+}
+
+double G1Analytics::predict_weak_proc_time_ms(bool for_young_only_phase) const {
+  return predict_zero_bounded(&_weak_proc_time_ms_seq, for_young_only_phase);
+}
+
 double G1Analytics::predict_young_other_time_ms(size_t young_num) const {
   return young_num * predict_zero_bounded(&_young_other_cost_per_region_ms_seq);
 }
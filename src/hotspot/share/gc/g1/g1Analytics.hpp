@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -66,6 +66,11 @@ class G1Analytics: public CHeapObj<mtGC> {
   G1PhaseDependentSeq _card_rs_length_seq;
   G1PhaseDependentSeq _code_root_rs_length_seq;
 
+  // Time taken by serial phases of the pause that do not depend on the size of
+  // the collection set but may vary considerably with the application.
+  G1PhaseDependentSeq _ref_proc_time_ms_seq;
+  G1PhaseDependentSeq _weak_proc_time_ms_seq;
+
   TruncatedSeq _constant_other_time_ms_seq;
   TruncatedSeq _young_other_cost_per_region_ms_seq;
   TruncatedSeq _non_young_other_cost_per_region_ms_seq;
@@ -136,6 +141,8 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_constant_other_time_ms(double constant_other_time_ms);
+  void report_ref_proc_time_ms(double ref_proc_time_ms, bool for_young_only_phase);
+  void report_weak_proc_time_ms(double weak_proc_time_ms, bool for_young_only_phase);
   void report_pending_cards(double pending_cards, bool for_young_only_phase);
   void report_card_rs_length(double card_rs_length, bool for_young_only_phase);
   void report_code_root_rs_length(double code_root_rs_length, bool for_young_only_phase);
@@ -160,6 +167,9 @@ class G1Analytics: public CHeapObj<mtGC> {
 
   double predict_constant_other_time_ms() const;
 
+  double predict_ref_proc_time_ms(bool for_young_only_phase) const;
+  double predict_weak_proc_time_ms(bool for_young_only_phase) const;
+
   double predict_young_other_time_ms(size_t young_num) const;
 
   double predict_non_young_other_time_ms(size_t non_young_num) const;
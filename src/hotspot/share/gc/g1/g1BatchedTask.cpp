@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -58,6 +58,9 @@ G1BatchedTask::G1BatchedTask(const char* name, G1GCPhaseTimes* phase_times) :
   WorkerTask(name),
   _num_serial_tasks_done(0),
   _phase_times(phase_times),
+  _max_workers(0),
+  _total_work_time_ns(0),
+  _run_time(),
   _serial_tasks(),
   _parallel_tasks() {
 }
@@ -73,7 +76,20 @@ uint G1BatchedTask::num_workers_estimate() const {
   return ceil(sum);
 }
 
+static int compare_worker_cost(G1AbstractSubTask** a, G1AbstractSubTask** b) {
+  double cost_a = (*a)->worker_cost();
+  double cost_b = (*b)->worker_cost();
+  if (cost_a > cost_b) {
+    return -1;
+  } else if (cost_a < cost_b) {
+    return 1;
+  }
+  return 0;
+}
+
 void G1BatchedTask::set_max_workers(uint max_workers) {
+  _max_workers = max_workers;
+  _serial_tasks.sort(compare_worker_cost);
   for (G1AbstractSubTask* task : _serial_tasks) {
     task->set_max_workers(max_workers);
   }
@@ -83,6 +99,7 @@ void G1BatchedTask::set_max_workers(uint max_workers) {
 }
 
 void G1BatchedTask::work(uint worker_id) {
+  Ticks start = Ticks::now();
   int t = 0;
   while (try_claim_serial_task(t)) {
     G1AbstractSubTask* task = _serial_tasks.at(t);
@@ -93,6 +110,15 @@ void G1BatchedTask::work(uint worker_id) {
     G1GCParPhaseTimesTracker x(_phase_times, task->tag(), worker_id);
     task->do_work(worker_id);
   }
+  Atomic::add(&_total_work_time_ns, (jlong)(Ticks::now() - start).nanoseconds());
+}
+
+double G1BatchedTask::worker_utilization() const {
+  jlong available_ns = (jlong)_run_time.nanoseconds() * _max_workers;
+  if (available_ns <= 0) {
+    return 0.0;
+  }
+  return MIN2((double)Atomic::load(&_total_work_time_ns) / available_ns, 1.0);
 }
 
 G1BatchedTask::~G1BatchedTask() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "memory/allocation.hpp"
+#include "utilities/ticks.hpp"
 
 template <typename E, MemTag MT>
 class GrowableArrayCHeap;
@@ -96,9 +97,12 @@ class G1AbstractSubTask : public CHeapObj<mtGC> {
 //
 // During execution in workers, this class will make sure that the "serial"
 // tasks are executed by a single worker exactly once, but different "serial"
-// tasks may be executed in parallel using different workers. "Parallel" tasks'
-// do_work() method may be called by different workers passing a different
-// worker_id at the same time, but at most once per given worker_id.
+// tasks may be executed in parallel using different workers. "Serial" tasks
+// are claimed in order of decreasing worker cost, so that the most expensive
+// ones start first and workers left idle can move on to the cheaper ones.
+// "Parallel" tasks' do_work() method may be called by different workers
+// passing a different worker_id at the same time, but at most once per given
+// worker_id.
 //
 // There is also no guarantee that G1AbstractSubTasks::do_work() of different tasks
 // are actually run in parallel.
@@ -123,6 +127,11 @@ class G1BatchedTask : public WorkerTask {
   volatile int _num_serial_tasks_done;
   G1GCPhaseTimes* _phase_times;
 
+  uint _max_workers;
+  // Sum of the time the workers spent in work().
+  volatile jlong _total_work_time_ns;
+  Tickspan _run_time;
+
   bool try_claim_serial_task(int& task);
 
   NONCOPYABLE(G1BatchedTask);
@@ -146,6 +155,11 @@ class G1BatchedTask : public WorkerTask {
   // given number of workers.
   void set_max_workers(uint max_workers);
 
+  // Records the elapsed time of running this task on the workers.
+  void record_run_time(Tickspan run_time) { _run_time = run_time; }
+  // The fraction of the elapsed time of the run the workers spent working.
+  double worker_utilization() const;
+
   ~G1BatchedTask();
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -396,7 +396,10 @@ G1CardSet::G1CardSet(G1CardSetConfiguration* config, G1CardSetMemoryManager* mm)
   _mm(mm),
   _config(config),
   _table(new G1CardSetHashTable(mm)),
-  _num_occupied(0) {
+  _num_occupied(0),
+  _num_coarsened_to_array(0),
+  _num_coarsened_to_howl(0),
+  _num_array_of_cards_skips(0) {
 }
 
 G1CardSet::~G1CardSet() {
@@ -610,6 +613,36 @@ G1CardSet::ContainerPtr G1CardSet::create_coarsened_array_of_cards(uint card_in_
   return new_container;
 }
 
+bool G1CardSet::should_skip_array_of_cards() {
+  uint num_to_array = Atomic::load(&_num_coarsened_to_array);
+  if (num_to_array < MinCoarsenSamples) {
+    return false;
+  }
+  // More than three quarters of all Array of Cards containers were coarsened
+  // further.
+  if (Atomic::load(&_num_coarsened_to_howl) <= num_to_array / 4 * 3) {
+    return false;
+  }
+  // Still send a sample of the containers through Array of Cards, so that the
+  // statistics keep being based on observed outcomes.
+  return Atomic::add(&_num_array_of_cards_skips, 1u, memory_order_relaxed) % ArrayOfCardsSampleInterval != 0;
+}
+
+void G1CardSet::record_coarsening(uint from_type) {
+  switch (from_type) {
+    case ContainerInlinePtr: {
+      Atomic::inc(&_num_coarsened_to_array, memory_order_relaxed);
+      break;
+    }
+    case ContainerArrayOfCards: {
+      Atomic::inc(&_num_coarsened_to_howl, memory_order_relaxed);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
 bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
                                   ContainerPtr cur_container,
                                   uint card_in_region,
@@ -626,6 +659,10 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
       break;
     }
     case ContainerInlinePtr: {
+      if (!within_howl && should_skip_array_of_cards()) {
+        new_container = create_coarsened_array_of_cards(card_in_region, within_howl);
+        break;
+      }
       uint const size = _config->max_cards_in_array();
       uint8_t* data = allocate_mem_object(ContainerArrayOfCards);
       new (data) G1CardSetArray(card_in_region, size);
@@ -649,6 +686,13 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
     // check its result).
     bool should_free = release_container(cur_container);
     assert(!should_free, "must have had more than one reference");
+    // A skipped Array of Cards says nothing about how many cards it would have
+    // held, so only count transitions that went through it.
+    bool skipped_array_of_cards = container_type(cur_container) == ContainerInlinePtr &&
+                                  container_type(new_container) == ContainerHowl;
+    if (!within_howl && !skipped_array_of_cards) {
+      record_coarsening(container_type(cur_container));
+    }
     // Free containers if cur_container is ContainerHowl
     if (container_type(cur_container) == ContainerHowl) {
       G1ReleaseCardsets rel(this);
@@ -1056,6 +1100,13 @@ size_t G1CardSet::static_mem_size() {
 void G1CardSet::clear() {
   _table->reset();
   _num_occupied = 0;
+  // Keep the observed ratio, but with the least weight to quickly adapt to
+  // changes.
+  uint num_to_array = _num_coarsened_to_array;
+  if (num_to_array > MinCoarsenSamples) {
+    _num_coarsened_to_howl = (uint)((uint64_t)_num_coarsened_to_howl * MinCoarsenSamples / num_to_array);
+    _num_coarsened_to_array = MinCoarsenSamples;
+  }
   _mm->flush();
 }
 
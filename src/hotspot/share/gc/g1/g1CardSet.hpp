@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -273,6 +273,27 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   // be (slightly) more cards in the card set than this value in reality.
   size_t _num_occupied;
 
+  // Number of top-level containers that have been coarsened from Inline Ptr to
+  // Array of Cards, and from Array of Cards to Howl in this card set. If most
+  // containers end up as Howl anyway, new containers skip the Array of Cards
+  // stage. The values are scaled down instead of reset on clear() so that the
+  // card density observed during earlier use of the card set carries over.
+  volatile uint _num_coarsened_to_array;
+  volatile uint _num_coarsened_to_howl;
+  // Number of decisions to skip Array of Cards; every
+  // ArrayOfCardsSampleInterval-th container still goes through it.
+  volatile uint _num_array_of_cards_skips;
+
+  // Minimum number of containers coarsened to Array of Cards to base the
+  // decision on.
+  static const uint MinCoarsenSamples = 16;
+  static const uint ArrayOfCardsSampleInterval = 8;
+
+  // Returns whether container coarsening should directly go from Inline Ptr to
+  // Howl based on the coarsening statistics of this card set.
+  bool should_skip_array_of_cards();
+  void record_coarsening(uint from_type);
+
   ContainerPtr make_container_ptr(void* value, uintptr_t type);
 
   ContainerPtr acquire_container(ContainerPtr volatile* container_addr);
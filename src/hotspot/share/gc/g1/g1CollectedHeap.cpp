@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -142,7 +142,9 @@ void G1RegionMappingChangedListener::on_commit(uint start_idx, size_t num_region
 void G1CollectedHeap::run_batch_task(G1BatchedTask* cl) {
   uint num_workers = MAX2(1u, MIN2(cl->num_workers_estimate(), workers()->active_workers()));
   cl->set_max_workers(num_workers);
+  Ticks start = Ticks::now();
   workers()->run_task(cl, num_workers);
+  cl->record_run_time(Ticks::now() - start);
 }
 
 uint G1CollectedHeap::get_chunks_per_region() {
@@ -1014,14 +1016,17 @@ bool G1CollectedHeap::expand(size_t expand_bytes, WorkerThreads* pretouch_worker
   assert(regions_to_expand > 0, "Must expand by at least one region");
 
   uint expanded_by = _hrm.expand_by(regions_to_expand, pretouch_workers);
+  double expand_heap_time_ms = (os::elapsedTime() - expand_heap_start_time_sec) * MILLIUNITS;
   if (expand_time_ms != nullptr) {
-    *expand_time_ms = (os::elapsedTime() - expand_heap_start_time_sec) * MILLIUNITS;
+    *expand_time_ms = expand_heap_time_ms;
   }
 
   assert(expanded_by > 0, "must have failed during commit.");
 
   size_t actual_expand_bytes = expanded_by * G1HeapRegion::GrainBytes;
   assert(actual_expand_bytes <= aligned_expand_bytes, "post-condition");
+  log_debug(gc, ergo, heap)("Expanded the heap by %u regions (%zuB) in %1.3fms",
+                            expanded_by, actual_expand_bytes, expand_heap_time_ms);
   policy()->record_new_heap_size(num_committed_regions());
 
   return true;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,6 +59,7 @@ G1CollectionSet::G1CollectionSet(G1CollectedHeap* g1h, G1Policy* policy) :
   _eden_region_length(0),
   _survivor_region_length(0),
   _initial_old_region_length(0),
+  _predicted_pause_time_ms(0.0),
   _optional_groups(),
   _inc_build_state(Inactive),
   _inc_part_start(0) {
@@ -311,7 +312,8 @@ double G1CollectionSet::finalize_young_part(double target_pause_time_ms, G1Survi
   // again.
   double predicted_eden_time = _policy->predict_young_region_other_time_ms(eden_region_length) +
                                _policy->predict_eden_copy_time_ms(eden_region_length);
-  double remaining_time_ms = MAX2(target_pause_time_ms - (predicted_base_time_ms + predicted_eden_time), 0.0);
+  _predicted_pause_time_ms = predicted_base_time_ms + predicted_eden_time;
+  double remaining_time_ms = MAX2(target_pause_time_ms - _predicted_pause_time_ms, 0.0);
 
   log_trace(gc, ergo, cset)("Added young regions to CSet. Eden: %u regions, Survivors: %u regions, "
                             "predicted eden time: %1.2fms, predicted base time: %1.2fms, target pause time: %1.2fms, remaining time: %1.2fms",
@@ -473,6 +475,8 @@ double G1CollectionSet::select_candidates_from_marking(double time_remaining_ms)
                               num_expensive_regions);
   }
 
+  _predicted_pause_time_ms += predicted_initial_time_ms;
+
   log_debug(gc, ergo, cset)("Finish adding marking candidates to collection set. Initial: %u regions (%u groups), optional: %u regions (%u groups), "
                             "predicted initial time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2fms",
                             selected_groups.num_regions(), selected_groups.length(), _optional_groups.num_regions(), _optional_groups.length(),
@@ -582,6 +586,8 @@ void G1CollectionSet::select_candidates_from_retained(double time_remaining_ms)
   assert(num_optional_regions >= prev_num_optional_regions, "Sanity");
   uint selected_optional_regions = num_optional_regions - prev_num_optional_regions;
 
+  _predicted_pause_time_ms += predicted_initial_time_ms;
+
   log_debug(gc, ergo, cset)("Finish adding retained candidates to collection set. Initial: %u, optional: %u, pinned: %u, "
                             "predicted initial time: %1.2fms, predicted optional time: %1.2fms, "
                             "time remaining: %1.2fms optional time remaining %1.2fms",
@@ -616,6 +622,8 @@ double G1CollectionSet::select_candidates_from_optional_groups(double time_remai
     selected.append(group);
   }
 
+  _predicted_pause_time_ms += total_prediction_ms;
+
   log_debug(gc, ergo, cset) ("Completed with groups, selected %u", num_regions_selected);
   // Remove selected groups from candidate list.
   if (num_groups_selected > 0) {
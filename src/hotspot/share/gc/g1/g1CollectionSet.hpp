@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -158,6 +158,10 @@ class G1CollectionSet {
   uint _survivor_region_length;
   uint _initial_old_region_length;
 
+  // Predicted time for the current pause in ms, accumulated while selecting regions
+  // into the collection set.
+  double _predicted_pause_time_ms;
+
   // When doing mixed collections we can add old regions to the collection set, which
   // will be collected only if there is enough time. We call these optional (old) regions.
   G1CSetCandidateGroupList _optional_groups;
@@ -287,6 +291,9 @@ class G1CollectionSet {
 
   void iterate_optional(G1HeapRegionClosure* cl) const;
 
+  // Predicted time for evacuating the collection set selected so far in this pause.
+  double predicted_pause_time_ms() const { return _predicted_pause_time_ms; }
+
   // Finalize the initial collection set consisting of all young regions potentially a
   // few old gen regions.
   void finalize_initial_collection_set(double target_pause_time_ms, G1SurvivorRegions* survivor);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -108,17 +108,29 @@ bool G1CMBitMapClosure::do_addr(HeapWord* const addr) {
 }
 
 G1CMMarkStack::G1CMMarkStack() :
-  _chunk_allocator() {
+  _chunk_allocator(),
+  _worker_free_chunks(nullptr),
+  _max_num_workers(0) {
   set_empty();
 }
 
+G1CMMarkStack::~G1CMMarkStack() {
+  FREE_C_HEAP_ARRAY(TaskQueueEntryChunk*, _worker_free_chunks);
+}
+
 size_t G1CMMarkStack::capacity_alignment() {
   return (size_t)lcm(os::vm_allocation_granularity(), sizeof(TaskQueueEntryChunk)) / sizeof(G1TaskQueueEntry);
 }
 
-bool G1CMMarkStack::initialize() {
+bool G1CMMarkStack::initialize(uint max_num_workers) {
   guarantee(_chunk_allocator.capacity() == 0, "G1CMMarkStack already initialized.");
 
+  _max_num_workers = max_num_workers;
+  _worker_free_chunks = NEW_C_HEAP_ARRAY(TaskQueueEntryChunk*, _max_num_workers, mtGC);
+  for (uint i = 0; i < _max_num_workers; i++) {
+    _worker_free_chunks[i] = nullptr;
+  }
+
   size_t initial_capacity = MarkStackSize;
   size_t max_capacity = MarkStackSizeMax;
 
@@ -324,9 +336,15 @@ G1CMMarkStack::TaskQueueEntryChunk* G1CMMarkStack::remove_chunk_from_free_list()
   return remove_chunk_from_list(&_free_list);
 }
 
-bool G1CMMarkStack::par_push_chunk(G1TaskQueueEntry* ptr_arr) {
-  // Get a new chunk.
-  TaskQueueEntryChunk* new_chunk = remove_chunk_from_free_list();
+bool G1CMMarkStack::par_push_chunk(G1TaskQueueEntry* ptr_arr, uint worker_id) {
+  assert(worker_id < _max_num_workers, "Worker id %u out of range %u", worker_id, _max_num_workers);
+  // Get a new chunk, preferably the one cached by this worker.
+  TaskQueueEntryChunk* new_chunk = _worker_free_chunks[worker_id];
+  if (new_chunk != nullptr) {
+    _worker_free_chunks[worker_id] = nullptr;
+  } else {
+    new_chunk = remove_chunk_from_free_list();
+  }
 
   if (new_chunk == nullptr) {
     // Did not get a chunk from the free list. Allocate from backing memory.
@@ -344,7 +362,8 @@ bool G1CMMarkStack::par_push_chunk(G1TaskQueueEntry* ptr_arr) {
   return true;
 }
 
-bool G1CMMarkStack::par_pop_chunk(G1TaskQueueEntry* ptr_arr) {
+bool G1CMMarkStack::par_pop_chunk(G1TaskQueueEntry* ptr_arr, uint worker_id) {
+  assert(worker_id < _max_num_workers, "Worker id %u out of range %u", worker_id, _max_num_workers);
   TaskQueueEntryChunk* cur = remove_chunk_from_chunk_list();
 
   if (cur == nullptr) {
@@ -353,7 +372,12 @@ bool G1CMMarkStack::par_pop_chunk(G1TaskQueueEntry* ptr_arr) {
 
   Copy::conjoint_memory_atomic(cur->data, ptr_arr, EntriesPerChunk * sizeof(G1TaskQueueEntry));
 
-  add_chunk_to_free_list(cur);
+  // Keep the chunk for the next push of this worker if possible.
+  if (_worker_free_chunks[worker_id] == nullptr) {
+    _worker_free_chunks[worker_id] = cur;
+  } else {
+    add_chunk_to_free_list(cur);
+  }
   return true;
 }
 
@@ -361,6 +385,9 @@ void G1CMMarkStack::set_empty() {
   _chunks_in_chunk_list = 0;
   _chunk_list = nullptr;
   _free_list = nullptr;
+  for (uint i = 0; i < _max_num_workers; i++) {
+    _worker_free_chunks[i] = nullptr;
+  }
   _chunk_allocator.reset();
 }
 
@@ -516,7 +543,8 @@ G1ConcurrentMark::G1ConcurrentMark(G1CollectedHeap* g1h,
   _region_mark_stats(NEW_C_HEAP_ARRAY(G1RegionMarkStats, _g1h->max_num_regions(), mtGC)),
   _top_at_mark_starts(NEW_C_HEAP_ARRAY(HeapWord*, _g1h->max_num_regions(), mtGC)),
   _top_at_rebuild_starts(NEW_C_HEAP_ARRAY(HeapWord*, _g1h->max_num_regions(), mtGC)),
-  _needs_remembered_set_rebuild(false)
+  _needs_remembered_set_rebuild(false),
+  _candidates_sorted(false)
 {
   assert(CGC_lock != nullptr, "CGC_lock must be initialized");
 
@@ -537,7 +565,7 @@ G1ConcurrentMark::G1ConcurrentMark(G1CollectedHeap* g1h,
   _concurrent_workers->initialize_workers();
   _num_concurrent_workers = _concurrent_workers->active_workers();
 
-  if (!_global_mark_stack.initialize()) {
+  if (!_global_mark_stack.initialize(_max_num_tasks)) {
     vm_exit_during_initialization("Failed to allocate initial concurrent mark overflow mark stack.");
   }
 
@@ -1443,6 +1471,7 @@ void G1ConcurrentMark::remark() {
                                         _g1h->num_committed_regions(), cl.total_selected_for_rebuild());
 
       _needs_remembered_set_rebuild = (cl.total_selected_for_rebuild() > 0);
+      _candidates_sorted = false;
 
       if (_needs_remembered_set_rebuild) {
         // Prune rebuild candidates based on G1HeapWastePercent.
@@ -1545,7 +1574,7 @@ void G1ConcurrentMark::cleanup() {
 
   {
     GCTraceTime(Debug, gc, phases) debug("Finalize Concurrent Mark Cleanup", _gc_timer_cm);
-    policy->record_concurrent_mark_cleanup_end(needs_remembered_set_rebuild());
+    policy->record_concurrent_mark_cleanup_end(needs_remembered_set_rebuild(), _candidates_sorted);
   }
 }
 
@@ -2034,6 +2063,31 @@ void G1ConcurrentMark::rebuild_and_scrub() {
   G1ConcurrentRebuildAndScrub::rebuild_and_scrub(this, needs_remembered_set_rebuild(), _concurrent_workers);
 }
 
+void G1ConcurrentMark::sort_collection_set_candidates() {
+  if (!needs_remembered_set_rebuild()) {
+    return;
+  }
+
+  SuspendibleThreadSetJoiner sts_join;
+
+  // Young collections do not change the candidates from marking, so it is safe
+  // to yield in between. Only a Full GC, aborting marking, does.
+  G1CSetCandidateGroupList& groups = _g1h->policy()->candidates()->from_marking_groups();
+  for (uint i = 0; i < groups.length(); i++) {
+    if (SuspendibleThreadSet::should_yield()) {
+      SuspendibleThreadSet::yield();
+      if (has_aborted()) {
+        return;
+      }
+    }
+    groups.at(i)->calculate_efficiency();
+  }
+  groups.sort_by_efficiency();
+  groups.verify();
+
+  _candidates_sorted = true;
+}
+
 void G1ConcurrentMark::print_stats() {
   if (!log_is_enabled(Debug, gc, stats)) {
     return;
@@ -2325,7 +2379,7 @@ void G1CMTask::move_entries_to_global_stack() {
   }
 
   if (n > 0) {
-    if (!_cm->mark_stack_push(buffer)) {
+    if (!_cm->mark_stack_push(buffer, _worker_id)) {
       set_has_aborted();
     }
   }
@@ -2339,7 +2393,7 @@ bool G1CMTask::get_entries_from_global_stack() {
   // from the global stack.
   G1TaskQueueEntry buffer[G1CMMarkStack::EntriesPerChunk];
 
-  if (!_cm->mark_stack_pop(buffer)) {
+  if (!_cm->mark_stack_pop(buffer, _worker_id)) {
     return false;
   }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -245,6 +245,12 @@ class G1CMMarkStack {
   volatile size_t _chunks_in_chunk_list;
   char _pad2[DEFAULT_PADDING_SIZE - sizeof(TaskQueueEntryChunk*) - sizeof(size_t)];
 
+  // Per worker cache of a single free chunk. A worker keeps the chunk freed by its
+  // last pop and uses it for its next push, avoiding the shared free list lock for
+  // the common alternating push/pop pattern.
+  TaskQueueEntryChunk** _worker_free_chunks;
+  uint _max_num_workers;
+
   // Atomically add the given chunk to the list.
   void add_chunk_to_list(TaskQueueEntryChunk* volatile* list, TaskQueueEntryChunk* elem);
   // Atomically remove and return a chunk from the given list. Returns null if the
@@ -259,25 +265,25 @@ class G1CMMarkStack {
 
  public:
   G1CMMarkStack();
-  ~G1CMMarkStack() = default;
+  ~G1CMMarkStack();
 
   // Alignment and minimum capacity of this mark stack in number of oops.
   static size_t capacity_alignment();
 
-  // Allocate and initialize the mark stack.
-  bool initialize();
+  // Allocate and initialize the mark stack for use by at most max_num_workers workers.
+  bool initialize(uint max_num_workers);
 
   // Pushes the given buffer containing at most EntriesPerChunk elements on the mark
   // stack. If less than EntriesPerChunk elements are to be pushed, the array must
   // be terminated with a null.
   // Returns whether the buffer contents were successfully pushed to the global mark
   // stack.
-  bool par_push_chunk(G1TaskQueueEntry* buffer);
+  bool par_push_chunk(G1TaskQueueEntry* buffer, uint worker_id);
 
   // Pops a chunk from this mark stack, copying them into the given buffer. This
   // chunk may contain up to EntriesPerChunk elements. If there are less, the last
   // element in the array is a null pointer.
-  bool par_pop_chunk(G1TaskQueueEntry* buffer);
+  bool par_pop_chunk(G1TaskQueueEntry* buffer, uint worker_id);
 
   // Return whether the chunk list is empty. Racy due to unsynchronized access to
   // _chunk_list.
@@ -551,6 +557,9 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   HeapWord* volatile* _top_at_rebuild_starts;
   // True when Remark pause selected regions for rebuilding.
   bool _needs_remembered_set_rebuild;
+  // True when the collection set candidates from marking have been sorted
+  // concurrently after rebuilding the remembered sets.
+  bool _candidates_sorted;
 public:
   // To be called when an object is marked the first time, e.g. after a successful
   // mark_in_bitmap call. Updates various statistics data.
@@ -588,15 +597,15 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   // Manipulation of the global mark stack.
   // The push and pop operations are used by tasks for transfers
   // between task-local queues and the global mark stack.
-  bool mark_stack_push(G1TaskQueueEntry* arr) {
-    if (!_global_mark_stack.par_push_chunk(arr)) {
+  bool mark_stack_push(G1TaskQueueEntry* arr, uint worker_id) {
+    if (!_global_mark_stack.par_push_chunk(arr, worker_id)) {
       set_has_overflown();
       return false;
     }
     return true;
   }
-  bool mark_stack_pop(G1TaskQueueEntry* arr) {
-    return _global_mark_stack.par_pop_chunk(arr);
+  bool mark_stack_pop(G1TaskQueueEntry* arr, uint worker_id) {
+    return _global_mark_stack.par_pop_chunk(arr, worker_id);
   }
   size_t mark_stack_size() const                { return _global_mark_stack.size(); }
   size_t partial_mark_stack_size_target() const { return _global_mark_stack.capacity() / 3; }
@@ -723,6 +732,11 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
   // to the application. Also scrubs dead objects to ensure region is parsable.
   void rebuild_and_scrub();
 
+  // Calculates the gc efficiency of the collection set candidates from marking
+  // and sorts them concurrently to the application, taking this work off the
+  // Cleanup pause.
+  void sort_collection_set_candidates();
+
   uint needs_remembered_set_rebuild() const { return _needs_remembered_set_rebuild; }
 };
 
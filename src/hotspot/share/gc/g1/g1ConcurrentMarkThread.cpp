@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -245,6 +245,12 @@ bool G1ConcurrentMarkThread::phase_rebuild_and_scrub() {
   return _cm->has_aborted();
 }
 
+bool G1ConcurrentMarkThread::phase_sort_collection_set_candidates() {
+  G1ConcPhaseTimer p(_cm, "Concurrent Sort Collection Set Candidates");
+  _cm->sort_collection_set_candidates();
+  return _cm->has_aborted();
+}
+
 bool G1ConcurrentMarkThread::phase_delay_to_keep_mmu_before_cleanup() {
   delay_to_keep_mmu(false /* cleanup */);
   return _cm->has_aborted();
@@ -298,16 +304,19 @@ void G1ConcurrentMarkThread::concurrent_mark_cycle_do() {
   // Phase 3: Rebuild remembered sets and scrub dead objects.
   if (phase_rebuild_and_scrub()) return;
 
-  // Phase 4: Wait for Cleanup.
+  // Phase 4: Sort collection set candidates.
+  if (phase_sort_collection_set_candidates()) return;
+
+  // Phase 5: Wait for Cleanup.
   if (phase_delay_to_keep_mmu_before_cleanup()) return;
 
-  // Phase 5: Cleanup pause
+  // Phase 6: Cleanup pause
   if (phase_cleanup()) return;
 
-  // Phase 6: Clear CLD claimed marks.
+  // Phase 7: Clear CLD claimed marks.
   if (phase_clear_cld_claimed_marks()) return;
 
-  // Phase 7: Clear bitmap for next mark.
+  // Phase 8: Clear bitmap for next mark.
   phase_clear_bitmap_for_next_mark();
 }
 
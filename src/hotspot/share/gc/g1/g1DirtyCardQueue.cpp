@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -477,37 +477,33 @@ void G1DirtyCardQueueSet::handle_refined_buffer(BufferNode* node,
 
 void G1DirtyCardQueueSet::handle_completed_buffer(BufferNode* new_node,
                                                   G1ConcurrentRefineStats* stats) {
-  enqueue_completed_buffer(new_node);
-
-  // No need for mutator refinement if number of cards is below limit.
-  if (Atomic::load(&_num_cards) <= Atomic::load(&_mutator_refinement_threshold)) {
-    return;
-  }
-
-  // Don't try to process a buffer that will just get immediately paused.
-  // When going into a safepoint it's just a waste of effort.
-  // When coming out of a safepoint, Java threads may be running before the
-  // yield request (for non-Java threads) has been cleared.
-  if (SuspendibleThreadSet::should_yield()) {
+  // No need for mutator refinement if number of cards, including those in
+  // the new buffer, is below limit.
+  size_t num_cards = Atomic::load(&_num_cards) + new_node->size();
+  if ((num_cards <= Atomic::load(&_mutator_refinement_threshold)) ||
+      // Don't try to process a buffer that will just get immediately paused.
+      // When going into a safepoint it's just a waste of effort.
+      // When coming out of a safepoint, Java threads may be running before the
+      // yield request (for non-Java threads) has been cleared.
+      SuspendibleThreadSet::should_yield() ||
+      // Only Java threads perform mutator refinement.
+      !Thread::current()->is_Java_thread()) {
+    enqueue_completed_buffer(new_node);
     return;
   }
 
-  // Only Java threads perform mutator refinement.
-  if (!Thread::current()->is_Java_thread()) {
-    return;
-  }
-
-  BufferNode* node = get_completed_buffer();
-  if (node == nullptr) return;     // Didn't get a buffer to process.
-
-  // Refine cards in buffer.
+  // Refine cards in the new buffer directly, rather than adding it to the
+  // completed queue and then taking a (possibly different) buffer back off.
+  // That avoids two operations on the completed queue, which is shared with
+  // the refinement threads and other mutators, and the buffer's cards were
+  // just touched by this thread.
 
   uint worker_id = _free_ids.claim_par_id(); // temporarily claim an id
-  bool fully_processed = refine_buffer(node, worker_id, stats);
+  bool fully_processed = refine_buffer(new_node, worker_id, stats);
   _free_ids.release_par_id(worker_id); // release the id
 
   // Deal with buffer after releasing id, to let another thread use id.
-  handle_refined_buffer(node, fully_processed);
+  handle_refined_buffer(new_node, fully_processed);
 }
 
 bool G1DirtyCardQueueSet::refine_completed_buffer_concurrently(uint worker_id,
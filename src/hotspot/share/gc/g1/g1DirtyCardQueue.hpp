@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -222,10 +222,10 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // Called when queue is full or has no buffer.
   void handle_zero_index(G1DirtyCardQueue& queue);
 
-  // Enqueue the buffer, and optionally perform refinement by the mutator.
+  // Either enqueue the buffer, or perform refinement of it by the mutator.
   // Mutator refinement is only done by Java threads, and only if there
-  // are more than mutator_refinement_threshold cards in the completed buffers.
-  // Updates stats.
+  // would be more than mutator_refinement_threshold cards in the completed
+  // buffers after adding the buffer.  Updates stats.
   //
   // Mutator refinement, if performed, stops processing a buffer if
   // SuspendibleThreadSet::should_yield(), recording the incompletely
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,7 +40,15 @@
 G1DetermineCompactionQueueClosure::G1DetermineCompactionQueueClosure(G1FullCollector* collector) :
   _g1h(G1CollectedHeap::heap()),
   _collector(collector),
-  _cur_worker(0) { }
+  _queue_work(NEW_C_HEAP_ARRAY(size_t, collector->workers(), mtGC)) {
+  for (uint i = 0; i < collector->workers(); i++) {
+    _queue_work[i] = 0;
+  }
+}
+
+G1DetermineCompactionQueueClosure::~G1DetermineCompactionQueueClosure() {
+  FREE_C_HEAP_ARRAY(size_t, _queue_work);
+}
 
 bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(G1HeapRegion* hr) {
   uint region_idx = hr->hrm_index();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,26 +36,34 @@ class G1FullGCCompactionPoint;
 class G1HeapRegion;
 
 // Determines the regions in the heap that should be part of the compaction and
-// distributes them among the compaction queues in round-robin fashion.
+// distributes them among the compaction queues. Regions are assigned to the queue
+// with the least estimated work so far, so that forwarding and compacting take
+// about the same time for every worker even if live data is unevenly spread
+// across the heap, e.g. due to pinned or humongous regions.
 class G1DetermineCompactionQueueClosure : public G1HeapRegionClosure {
   G1CollectedHeap* _g1h;
   G1FullCollector* _collector;
-  uint _cur_worker;
+  // Estimated work in words assigned to the compaction queue of each worker.
+  size_t* _queue_work;
 
   inline void free_empty_humongous_region(G1HeapRegion* hr);
 
   inline bool should_compact(G1HeapRegion* hr) const;
 
-  // Returns the current worker id to assign a compaction point to, and selects
-  // the next one round-robin style.
-  inline uint next_worker();
+  // Estimated work in words to prepare and compact the given region.
+  inline size_t region_work(G1HeapRegion* hr) const;
 
-  inline G1FullGCCompactionPoint* next_compaction_point();
+  // Returns the worker id of the compaction queue with the least work assigned
+  // and accounts the work for the given region to it.
+  inline uint next_worker(G1HeapRegion* hr);
+
+  inline G1FullGCCompactionPoint* next_compaction_point(G1HeapRegion* hr);
 
   inline void add_to_compaction_queue(G1HeapRegion* hr);
 
 public:
   G1DetermineCompactionQueueClosure(G1FullCollector* collector);
+  ~G1DetermineCompactionQueueClosure();
 
   inline bool do_heap_region(G1HeapRegion* hr) override;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2022, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,21 +52,33 @@ inline bool G1DetermineCompactionQueueClosure::should_compact(G1HeapRegion* hr)
   return live_words <= live_words_threshold;
 }
 
-inline uint G1DetermineCompactionQueueClosure::next_worker() {
-  uint result = _cur_worker;
-  _cur_worker = (_cur_worker + 1) % _collector->workers();
+inline size_t G1DetermineCompactionQueueClosure::region_work(G1HeapRegion* hr) const {
+  // Every region needs a walk over its part of the mark bitmap in addition to
+  // forwarding and copying the live objects.
+  const size_t bitmap_words = G1HeapRegion::GrainWords / BitsPerWord;
+  return _collector->live_words(hr->hrm_index()) + bitmap_words;
+}
+
+inline uint G1DetermineCompactionQueueClosure::next_worker(G1HeapRegion* hr) {
+  uint result = 0;
+  for (uint i = 1; i < _collector->workers(); i++) {
+    if (_queue_work[i] < _queue_work[result]) {
+      result = i;
+    }
+  }
+  _queue_work[result] += region_work(hr);
   return result;
 }
 
-inline G1FullGCCompactionPoint* G1DetermineCompactionQueueClosure::next_compaction_point() {
-  return _collector->compaction_point(next_worker());
+inline G1FullGCCompactionPoint* G1DetermineCompactionQueueClosure::next_compaction_point(G1HeapRegion* hr) {
+  return _collector->compaction_point(next_worker(hr));
 }
 
 inline void G1DetermineCompactionQueueClosure::add_to_compaction_queue(G1HeapRegion* hr) {
   _collector->set_compaction_top(hr, hr->bottom());
   _collector->set_has_compaction_targets();
 
-  G1FullGCCompactionPoint* cp = next_compaction_point();
+  G1FullGCCompactionPoint* cp = next_compaction_point(hr);
   if (!cp->is_initialized()) {
     cp->initialize(hr);
   }
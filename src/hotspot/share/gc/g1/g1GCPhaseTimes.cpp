@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -178,6 +178,8 @@ void G1GCPhaseTimes::reset() {
   _cur_pre_evacuate_prepare_time_ms = 0.0;
   _cur_post_evacuate_cleanup_1_time_ms = 0.0;
   _cur_post_evacuate_cleanup_2_time_ms = 0.0;
+  _cur_post_evacuate_cleanup_1_utilization = 0.0;
+  _cur_post_evacuate_cleanup_2_utilization = 0.0;
   _cur_expand_heap_time_ms = 0.0;
   _cur_ref_proc_time_ms = 0.0;
   _cur_collection_start_sec = 0.0;
@@ -407,6 +409,10 @@ void G1GCPhaseTimes::trace_count(const char* name, size_t value) const {
   log_trace(gc, phases)("      %s: %zu", name, value);
 }
 
+void G1GCPhaseTimes::debug_utilization(double value) const {
+  log_debug(gc, phases)("      Worker Utilization: %.1f%%", value * 100.0);
+}
+
 double G1GCPhaseTimes::print_pre_evacuate_collection_set() const {
   const double sum_ms = _cur_prepare_concurrent_task_time_ms +
                         _cur_pre_evacuate_prepare_time_ms +
@@ -500,6 +506,7 @@ double G1GCPhaseTimes::print_post_evacuate_collection_set(bool evacuation_failed
   _weak_phase_times.log_subtotals(3);
 
   debug_time("Post Evacuate Cleanup 1", _cur_post_evacuate_cleanup_1_time_ms);
+  debug_utilization(_cur_post_evacuate_cleanup_1_utilization);
   debug_phase(_gc_par_phases[MergePSS], 1);
   debug_phase(_gc_par_phases[ClearCardTable], 1);
   debug_phase(_gc_par_phases[RecalculateUsed], 1);
@@ -509,6 +516,7 @@ double G1GCPhaseTimes::print_post_evacuate_collection_set(bool evacuation_failed
   }
 
   debug_time("Post Evacuate Cleanup 2", _cur_post_evacuate_cleanup_2_time_ms);
+  debug_utilization(_cur_post_evacuate_cleanup_2_utilization);
   if (evacuation_failed) {
     debug_phase(_gc_par_phases[RecalculateUsed], 1);
     debug_phase(_gc_par_phases[ProcessEvacuationFailedRegions], 1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -187,6 +187,9 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   double _cur_post_evacuate_cleanup_1_time_ms;
   double _cur_post_evacuate_cleanup_2_time_ms;
+  // Fraction of the available worker time spent running subtasks.
+  double _cur_post_evacuate_cleanup_1_utilization;
+  double _cur_post_evacuate_cleanup_2_utilization;
 
   double _cur_expand_heap_time_ms;
   double _cur_ref_proc_time_ms;
@@ -243,6 +246,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   void debug_time_for_reference(const char* name, double value) const;
   void trace_time(const char* name, double value) const;
   void trace_count(const char* name, size_t value) const;
+  void debug_utilization(double value) const;
 
   double print_pre_evacuate_collection_set() const;
   double print_merge_heap_roots_time() const;
@@ -355,6 +359,14 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     _cur_post_evacuate_cleanup_2_time_ms = time_ms;
   }
 
+  void record_post_evacuate_cleanup_task_1_utilization(double utilization) {
+    _cur_post_evacuate_cleanup_1_utilization = utilization;
+  }
+
+  void record_post_evacuate_cleanup_task_2_utilization(double utilization) {
+    _cur_post_evacuate_cleanup_2_utilization = utilization;
+  }
+
   void record_young_cset_choice_time_ms(double time_ms) {
     _recorded_young_cset_choice_time_ms = time_ms;
   }
@@ -409,6 +421,14 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     return _cur_expand_heap_time_ms;
   }
 
+  double cur_ref_proc_time_ms() {
+    return _cur_ref_proc_time_ms;
+  }
+
+  double cur_weak_proc_time_ms() {
+    return _weak_phase_times.total_time_sec() * MILLIUNITS;
+  }
+
   double root_region_scan_wait_time_ms() {
     return _root_region_scan_wait_time_ms;
   }
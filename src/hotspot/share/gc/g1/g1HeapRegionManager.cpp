@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
+#include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 class G1MasterFreeRegionListChecker : public G1HeapRegionSetChecker {
@@ -285,6 +286,11 @@ bool G1HeapRegionManager::has_inactive_regions() const {
 uint G1HeapRegionManager::uncommit_inactive_regions(uint limit) {
   assert(limit > 0, "Need to specify at least one region to uncommit");
 
+  // Uncommit whole commit units of the heap storage at a time if possible. Uncommitting
+  // only part of the regions of a commit unit does not release any memory yet.
+  uint const regions_per_commit_unit = _heap_mapper->regions_per_commit_unit();
+  limit = align_up(limit, regions_per_commit_unit);
+
   uint uncommitted = 0;
   uint offset = 0;
   do {
@@ -298,6 +304,16 @@ uint G1HeapRegionManager::uncommit_inactive_regions(uint limit) {
 
     uint start = range.start();
     uint num_regions = MIN2(range.length(), limit - uncommitted);
+    if (num_regions < range.length()) {
+      // Stop at a commit unit boundary so that the next uncommit continues with
+      // whole commit units.
+      uint aligned_end = align_down(start + num_regions, regions_per_commit_unit);
+      if (aligned_end > start) {
+        num_regions = aligned_end - start;
+        uncommit_regions(start, num_regions);
+        return uncommitted + num_regions;
+      }
+    }
     uncommitted += num_regions;
     uncommit_regions(start, num_regions);
   } while (uncommitted < limit);
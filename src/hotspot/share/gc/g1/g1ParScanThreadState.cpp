@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -231,6 +231,7 @@ void G1ParScanThreadState::do_partial_array(PartialArrayState* state, bool stole
     _partial_array_splitter.claim(state, _task_queue, stolen);
   G1HeapRegionAttr dest_attr = _g1h->region_attr(to_array);
   G1SkipCardEnqueueSetter x(&_scanner, dest_attr.is_new_survivor());
+  PartialArraySplitter::ChunkCostTracker cost(&_partial_array_splitter, claim);
   // Process claimed task.
   to_array->oop_iterate_range(&_scanner,
                               checked_cast<int>(claim._start),
@@ -387,7 +388,7 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
     }
   }
   if (obj_ptr != nullptr) {
-    update_numa_stats(node_index);
+    update_numa_stats(*dest_attr, node_index);
     if (_g1h->gc_tracer_stw()->should_report_promotion_events()) {
       // The events are checked individually as part of the actual commit
       report_promotion_event(*dest_attr, klass, word_sz, age, obj_ptr, node_index);
@@ -676,22 +677,28 @@ void G1ParScanThreadState::initialize_numa_stats() {
     if (lt.is_enabled()) {
       uint num_nodes = _numa->num_active_nodes();
       // Record only if there are multiple active nodes.
-      _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
-      memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      size_t length = G1HeapRegionAttr::Num * num_nodes;
+      _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, length, mtGC);
+      memset(_obj_alloc_stat, 0, sizeof(size_t) * length);
     }
   }
 }
 
 void G1ParScanThreadState::flush_numa_stats() {
   if (_obj_alloc_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
     uint node_index = _numa->index_of_current_thread();
-    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index,
+                           _obj_alloc_stat + G1HeapRegionAttr::Young * num_nodes);
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToOld, node_index,
+                           _obj_alloc_stat + G1HeapRegionAttr::Old * num_nodes);
   }
 }
 
-void G1ParScanThreadState::update_numa_stats(uint node_index) {
+void G1ParScanThreadState::update_numa_stats(G1HeapRegionAttr dest, uint node_index) {
   if (_obj_alloc_stat != nullptr) {
-    _obj_alloc_stat[node_index]++;
+    assert(dest.is_young() || dest.is_old(), "must be either Young or Old");
+    _obj_alloc_stat[dest.type() * _numa->num_active_nodes() + node_index]++;
   }
 }
 
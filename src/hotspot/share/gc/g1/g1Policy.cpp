@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,7 @@
 #include "gc/g1/g1IHOPControl.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
+#include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcPolicyCounters.hpp"
@@ -733,7 +734,16 @@ double G1Policy::other_time_ms(double pause_time_ms) const {
 }
 
 double G1Policy::constant_other_time_ms(double pause_time_ms) const {
-  return other_time_ms(pause_time_ms) - (young_other_time_ms() + non_young_other_time_ms());
+  return other_time_ms(pause_time_ms) -
+         (young_other_time_ms() + non_young_other_time_ms() +
+          phase_times()->cur_ref_proc_time_ms() + phase_times()->cur_weak_proc_time_ms());
+}
+
+void G1Policy::report_pause_time_prediction(double pause_time_ms) const {
+  double predicted_pause_time_ms = _collection_set->predicted_pause_time_ms();
+  log_debug(gc, ergo)("Pause time prediction: predicted %1.2fms actual %1.2fms error %1.2fms target %1.2fms",
+                      predicted_pause_time_ms, pause_time_ms, pause_time_ms - predicted_pause_time_ms, max_pause_time_ms());
+  _g1h->gc_tracer_stw()->report_pause_time_prediction(max_pause_time_ms(), predicted_pause_time_ms, pause_time_ms);
 }
 
 bool G1Policy::about_to_start_mixed_phase() const {
@@ -931,6 +941,8 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
                                                             _collection_set->initial_old_region_length());
     }
 
+    _analytics->report_ref_proc_time_ms(phase_times()->cur_ref_proc_time_ms(), is_young_only_pause);
+    _analytics->report_weak_proc_time_ms(phase_times()->cur_weak_proc_time_ms(), is_young_only_pause);
     _analytics->report_constant_other_time_ms(constant_other_time_ms(pause_time_ms));
 
     _analytics->report_pending_cards((double)pending_cards_at_gc_start(), is_young_only_pause);
@@ -938,6 +950,8 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     _analytics->report_code_root_rs_length((double)total_code_roots_scanned, is_young_only_pause);
   }
 
+  report_pause_time_prediction(pause_time_ms);
+
   assert(!(G1GCPauseTypeHelper::is_concurrent_start_pause(this_pause) && collector_state()->mark_or_rebuild_in_progress()),
          "If the last pause has been concurrent start, we should not have been in the marking window");
   if (G1GCPauseTypeHelper::is_concurrent_start_pause(this_pause)) {
@@ -1069,17 +1083,20 @@ double G1Policy::predict_base_time_ms(size_t pending_cards,
   double card_merge_time = _analytics->predict_card_merge_time_ms(pending_cards + card_rs_length, in_young_only_phase);
   double card_scan_time = _analytics->predict_card_scan_time_ms(effective_scanned_cards, in_young_only_phase);
   double code_root_scan_time = _analytics->predict_code_root_scan_time_ms(code_root_rs_length, in_young_only_phase);
+  double ref_proc_time = _analytics->predict_ref_proc_time_ms(in_young_only_phase);
+  double weak_proc_time = _analytics->predict_weak_proc_time_ms(in_young_only_phase);
   double constant_other_time = _analytics->predict_constant_other_time_ms();
   double survivor_evac_time = predict_survivor_regions_evac_time();
 
-  double total_time = card_merge_time + card_scan_time + code_root_scan_time + constant_other_time + survivor_evac_time;
+  double total_time = card_merge_time + card_scan_time + code_root_scan_time +
+                      ref_proc_time + weak_proc_time + constant_other_time + survivor_evac_time;
 
   log_trace(gc, ergo, heap)("Predicted base time: total %f lb_cards %zu card_rs_length %zu effective_scanned_cards %zu "
                             "card_merge_time %f card_scan_time %f code_root_rs_length %zu code_root_scan_time %f "
-                            "constant_other_time %f survivor_evac_time %f",
+                            "ref_proc_time %f weak_proc_time %f constant_other_time %f survivor_evac_time %f",
                             total_time, pending_cards, card_rs_length, effective_scanned_cards,
                             card_merge_time, card_scan_time, code_root_rs_length, code_root_scan_time,
-                            constant_other_time, survivor_evac_time);
+                            ref_proc_time, weak_proc_time, constant_other_time, survivor_evac_time);
   return total_time;
 }
 
@@ -1146,6 +1163,19 @@ double G1Policy::predict_merge_scan_time(size_t card_rs_length) const {
     _analytics->predict_card_scan_time_ms(scan_card_num, false);
 }
 
+size_t G1Policy::max_eager_reclaim_obj_array_rs_length() const {
+  // Allow spending the share of the pause time goal given to remembered set
+  // updating on verifying that there are no references to these candidates.
+  double time_goal_ms = max_pause_time_ms() * G1RSetUpdatingPauseTimePercent / 100.0;
+
+  size_t sample_rs_length = MAX2(G1EagerReclaimRemSetThreshold, 1u);
+  double time_per_entry_ms = predict_merge_scan_time(sample_rs_length) / sample_rs_length;
+  if (time_per_entry_ms <= 0.0) {
+    return SIZE_MAX;
+  }
+  return (size_t)MIN2(time_goal_ms / time_per_entry_ms, (double)(SIZE_MAX / 2));
+}
+
 double G1Policy::predict_region_code_root_scan_time(G1HeapRegion* hr, bool for_young_only_phase) const {
   size_t code_root_length = hr->rem_set()->code_roots_list_length();
 
@@ -1300,10 +1330,12 @@ void G1Policy::decide_on_concurrent_start_pause() {
   assert(!collector_state()->mark_or_rebuild_in_progress() || collector_state()->in_young_only_phase(), "sanity");
 }
 
-void G1Policy::record_concurrent_mark_cleanup_end(bool has_rebuilt_remembered_sets) {
+void G1Policy::record_concurrent_mark_cleanup_end(bool has_rebuilt_remembered_sets, bool candidates_sorted) {
   bool mixed_gc_pending = false;
   if (has_rebuilt_remembered_sets) {
-    candidates()->sort_marking_by_efficiency();
+    if (!candidates_sorted) {
+      candidates()->sort_marking_by_efficiency();
+    }
     mixed_gc_pending = next_gc_should_be_mixed();
   }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -149,6 +149,9 @@ class G1Policy: public CHeapObj<mtGC> {
   double predict_region_code_root_scan_time(G1HeapRegion* hr, bool for_young_only_phase) const;
 
   double predict_merge_scan_time(size_t card_rs_length) const;
+  // Maximum total remembered set length of humongous object array eager reclaim
+  // candidates that can be merged and scanned within the pause time goal.
+  size_t max_eager_reclaim_obj_array_rs_length() const;
   // Predict other time for count young regions.
   double predict_young_region_other_time_ms(uint count) const;
   double predict_non_young_other_time_ms(uint count) const;
@@ -187,6 +190,9 @@ class G1Policy: public CHeapObj<mtGC> {
   double non_young_other_time_ms() const;
   double constant_other_time_ms(double pause_time_ms) const;
 
+  // Log and trace the predicted and actual time of the last pause.
+  void report_pause_time_prediction(double pause_time_ms) const;
+
   G1CollectionSetChooser* cset_chooser() const;
 
   // Stash a pointer to the g1 heap.
@@ -322,7 +328,7 @@ class G1Policy: public CHeapObj<mtGC> {
 
   // Record start, end, and completion of cleanup.
   void record_concurrent_mark_cleanup_start();
-  void record_concurrent_mark_cleanup_end(bool has_rebuilt_remembered_sets);
+  void record_concurrent_mark_cleanup_end(bool has_rebuilt_remembered_sets, bool candidates_sorted);
 
   bool next_gc_should_be_mixed() const;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,6 +73,11 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
   virtual void commit_regions(uint start_idx, size_t num_regions = 1, WorkerThreads* pretouch_workers = nullptr) = 0;
   virtual void uncommit_regions(uint start_idx, size_t num_regions = 1) = 0;
 
+  // The number of regions sharing a single commit unit, e.g. a (transparent)
+  // large page, of the underlying storage. The memory of a commit unit is only
+  // released when all of its regions have been uncommitted.
+  virtual uint regions_per_commit_unit() const { return 1; }
+
   // Creates an appropriate G1RegionToSpaceMapper for the given parameters.
   // The actual space to be used within the given reservation is given by actual_size.
   // This is because some OSes need to round up the reservation size to guarantee
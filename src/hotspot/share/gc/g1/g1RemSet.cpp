@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,6 +54,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -559,6 +561,37 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
       return ((uintptr_t)addr) % sizeof(Word) == 0;
     }
 
+    // Number of words checked at once when skipping over long runs of cards that
+    // are all non-dirty or all dirty. Combining the words first keeps the common
+    // case to a single branch per block and allows the compiler to vectorize.
+    static const uint WordsPerBlock = 4;
+    static const size_t CardsPerBlock = WordsPerBlock * sizeof(Word);
+
+    // Returns the index of the lowest addressed card in the word that has any
+    // bit in the given mask set.
+    static uint first_card_in_word(Word mask) {
+      assert(mask != 0, "must have a card");
+#ifdef VM_LITTLE_ENDIAN
+      return count_trailing_zeros(mask) / BitsPerByte;
+#else
+      return count_leading_zeros(mask) / BitsPerByte;
+#endif
+    }
+
+    // Returns a word with the lowest bit of all dirty cards set.
+    static Word dirty_cards_in_word(Word word_value) {
+      return ~word_value & ExpandedToScanMask;
+    }
+
+    // Returns a word with the lowest bit of all non-dirty cards set.
+    static Word non_dirty_cards_in_word(Word word_value) {
+      return word_value & ExpandedToScanMask;
+    }
+
+    size_t cards_left(const CardValue* i_card) const {
+      return pointer_delta(_end_card, i_card, sizeof(CardValue));
+    }
+
     CardValue* find_first_dirty_card(CardValue* i_card) const {
       while (!is_word_aligned(i_card)) {
         if (is_card_dirty(i_card)) {
@@ -567,18 +600,24 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
         i_card++;
       }
 
+      // Skip blocks without any dirty card.
+      while (cards_left(i_card) >= CardsPerBlock) {
+        const Word* words = reinterpret_cast<const Word*>(i_card);
+        Word all_words = words[0];
+        for (uint i = 1; i < WordsPerBlock; i++) {
+          all_words &= words[i];
+        }
+        if (dirty_cards_in_word(all_words) != 0) {
+          break;
+        }
+        i_card += CardsPerBlock;
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word dirty_cards = dirty_cards_in_word(*reinterpret_cast<Word*>(i_card));
+
+        if (dirty_cards != 0) {
+          return i_card + first_card_in_word(dirty_cards);
         }
       }
 
@@ -593,18 +632,24 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
         i_card++;
       }
 
+      // Skip blocks with only dirty cards.
+      while (cards_left(i_card) >= CardsPerBlock) {
+        const Word* words = reinterpret_cast<const Word*>(i_card);
+        Word any_words = words[0];
+        for (uint i = 1; i < WordsPerBlock; i++) {
+          any_words |= words[i];
+        }
+        if (any_words != G1CardTable::WordAllDirty) {
+          break;
+        }
+        i_card += CardsPerBlock;
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word non_dirty_cards = non_dirty_cards_in_word(*reinterpret_cast<Word*>(i_card));
+
+        if (non_dirty_cards != 0) {
+          return i_card + first_card_in_word(non_dirty_cards);
         }
       }
 
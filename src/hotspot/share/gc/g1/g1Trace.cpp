@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -126,6 +126,12 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_pause_time_prediction(double pause_target_ms,
+                                               double predicted_pause_time_ms,
+                                               double pause_time_ms) {
+  send_pause_time_prediction(pause_target_ms, predicted_pause_time_ms, pause_time_ms);
+}
+
 void G1NewTracer::send_g1_young_gc_event() {
   // Check that the pause type has been updated to something valid for this event.
   G1GCPauseTypeHelper::assert_is_young_pause(_pause);
@@ -247,6 +253,19 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_pause_time_prediction(double pause_target_ms,
+                                             double predicted_pause_time_ms,
+                                             double pause_time_ms) {
+  EventG1PauseTimePrediction evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_pauseTarget(pause_target_ms * NANOSECS_PER_MILLISEC);
+    evt.set_predictedPauseTime(predicted_pause_time_ms * NANOSECS_PER_MILLISEC);
+    evt.set_pauseTime(pause_time_ms * NANOSECS_PER_MILLISEC);
+    evt.commit();
+  }
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -63,6 +63,9 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+  void report_pause_time_prediction(double pause_target_ms,
+                                    double predicted_pause_time_ms,
+                                    double pause_time_ms);
 private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(G1EvacInfo* info);
@@ -84,6 +87,9 @@ class G1NewTracer : public YoungGCTracer, public CHeapObj<mtGC> {
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_pause_time_prediction(double pause_target_ms,
+                                  double predicted_pause_time_ms,
+                                  double pause_time_ms);
 };
 
 class G1OldTracer : public OldGCTracer, public CHeapObj<mtGC> {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,7 +31,7 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSetCandidates.inline.hpp"
 #include "gc/g1/g1CollectorState.hpp"
-#include "gc/g1/g1ConcurrentMark.hpp"
+#include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1EvacFailureRegions.inline.hpp"
 #include "gc/g1/g1EvacInfo.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
@@ -341,23 +341,41 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
       // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
+      // set entries on other regions. These become stale when the object
+      // is reclaimed, which is no different to any other region being
+      // freed. Cards of the object that were logged during the pause are
+      // cleaned after redirtying (see G1FreeHumongousRegionClosure).
       //
-      // We also treat is_typeArray() objects specially, allowing them
-      // to be reclaimed even if allocated before the start of
-      // concurrent mark.  For this we rely on mark stack insertion to
-      // exclude is_typeArray() objects, preventing reclaiming an object
-      // that is in the mark stack.  We also rely on the metadata for
-      // such objects to be built-in and so ensured to be kept live.
+      // We treat is_typeArray() objects specially, allowing them to be
+      // reclaimed even if allocated before the start of concurrent mark.
+      // For this we rely on mark stack insertion to exclude
+      // is_typeArray() objects, preventing reclaiming an object that is
+      // in the mark stack.  We also rely on the metadata for such objects
+      // to be built-in and so ensured to be kept live.
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
+      //
+      // is_objArray() objects are only nominated if allocated after the
+      // start of concurrent marking. Verifying that there are no references
+      // left requires merging and scanning their remembered sets, so the
+      // total remembered set length of such candidates is limited by the
+      // predicted pause time. Remaining ones are considered in later pauses.
+
+      if (obj->is_typeArray()) {
+        return _g1h->is_potential_eager_reclaim_candidate(region);
+      }
 
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      if (!obj->is_objArray()) {
+        return false;
+      }
+      if (_g1h->collector_state()->mark_or_rebuild_in_progress() &&
+          !_g1h->concurrent_mark()->obj_allocated_since_mark_start(obj)) {
+        return false;
+      }
+      return _g1h->is_potential_eager_reclaim_candidate(region) &&
+             _parent_task->try_claim_obj_array_rs_length(region->rem_set()->occupied());
     }
 
   public:
@@ -393,7 +411,7 @@ class G1PrepareEvacuationTask : public WorkerTask {
         _g1h->register_region_with_region_attr(hr);
       }
       log_debug(gc, humongous)("Humongous region %u (object size %zu @ " PTR_FORMAT ") remset %zu code roots %zu "
-                               "marked %d pinned count %zu reclaim candidate %d type array %d",
+                               "marked %d pinned count %zu reclaim candidate %d type array %d obj array %d",
                                index,
                                cast_to_oop(hr->bottom())->size() * HeapWordSize,
                                p2i(hr->bottom()),
@@ -402,7 +420,8 @@ class G1PrepareEvacuationTask : public WorkerTask {
                                _g1h->concurrent_mark()->mark_bitmap()->is_marked(hr->bottom()),
                                hr->pinned_count(),
                                _g1h->is_humongous_reclaim_candidate(index),
-                               cast_to_oop(hr->bottom())->is_typeArray()
+                               cast_to_oop(hr->bottom())->is_typeArray(),
+                               cast_to_oop(hr->bottom())->is_objArray()
                               );
       _worker_humongous_total++;
 
@@ -419,6 +438,11 @@ class G1PrepareEvacuationTask : public WorkerTask {
   volatile uint _humongous_total;
   volatile uint _humongous_candidates;
 
+  // Remembered set length of humongous object array candidates that may be
+  // verified during this pause, and the amount already claimed.
+  const size_t _max_obj_array_rs_length;
+  volatile size_t _obj_array_rs_length;
+
   G1MonotonicArenaMemoryStats _all_card_set_stats;
 
 public:
@@ -427,7 +451,9 @@ class G1PrepareEvacuationTask : public WorkerTask {
     _g1h(g1h),
     _claimer(_g1h->workers()->active_workers()),
     _humongous_total(0),
-    _humongous_candidates(0) { }
+    _humongous_candidates(0),
+    _max_obj_array_rs_length(g1h->policy()->max_eager_reclaim_obj_array_rs_length()),
+    _obj_array_rs_length(0) { }
 
   void work(uint worker_id) {
     G1PrepareRegionsClosure cl(_g1h, this);
@@ -445,6 +471,28 @@ class G1PrepareEvacuationTask : public WorkerTask {
     Atomic::add(&_humongous_total, total);
   }
 
+  bool try_claim_obj_array_rs_length(size_t rs_length) {
+    size_t cur = Atomic::load(&_obj_array_rs_length);
+    while (true) {
+      if (rs_length > _max_obj_array_rs_length - cur) {
+        return false;
+      }
+      size_t prev = Atomic::cmpxchg(&_obj_array_rs_length, cur, cur + rs_length);
+      if (prev == cur) {
+        return true;
+      }
+      cur = prev;
+    }
+  }
+
+  size_t obj_array_rs_length() const {
+    return _obj_array_rs_length;
+  }
+
+  size_t max_obj_array_rs_length() const {
+    return _max_obj_array_rs_length;
+  }
+
   uint humongous_candidates() {
     return _humongous_candidates;
   }
@@ -521,6 +569,9 @@ void G1YoungCollector::pre_evacuate_collection_set(G1EvacInfo* evacuation_info)
     _g1h->set_young_gen_card_set_stats(sampled_card_set_stats);
 
     _g1h->set_humongous_stats(g1_prep_task.humongous_total(), g1_prep_task.humongous_candidates());
+    log_debug(gc, humongous)("Humongous object array candidates remset length %zu (max %zu)",
+                             g1_prep_task.obj_array_rs_length(),
+                             g1_prep_task.max_obj_array_rs_length());
 
     phase_times()->record_register_regions(task_time.seconds() * 1000.0);
   }
@@ -990,6 +1041,7 @@ void G1YoungCollector::post_evacuate_cleanup_1(G1ParScanThreadStateSet* per_thre
   {
     G1PostEvacuateCollectionSetCleanupTask1 cl(per_thread_states, &_evac_failure_regions);
     _g1h->run_batch_task(&cl);
+    phase_times()->record_post_evacuate_cleanup_task_1_utilization(cl.worker_utilization());
   }
   phase_times()->record_post_evacuate_cleanup_task_1_time((Ticks::now() - start).seconds() * 1000.0);
 }
@@ -1000,6 +1052,7 @@ void G1YoungCollector::post_evacuate_cleanup_2(G1ParScanThreadStateSet* per_thre
   {
     G1PostEvacuateCollectionSetCleanupTask2 cl(per_thread_states, evacuation_info, &_evac_failure_regions);
     _g1h->run_batch_task(&cl);
+    phase_times()->record_post_evacuate_cleanup_task_2_utilization(cl.worker_utilization());
   }
   phase_times()->record_post_evacuate_cleanup_task_2_time((Ticks::now() - start).seconds() * 1000.0);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,6 +50,7 @@
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/bitMap.inline.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/ticks.hpp"
 
 class G1PostEvacuateCollectionSetCleanupTask1::MergePssTask : public G1AbstractSubTask {
@@ -341,6 +342,7 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
   uint _humongous_regions_reclaimed;
   size_t _freed_bytes;
   G1CollectedHeap* _g1h;
+  GrowableArrayCHeap<G1HeapRegion*, mtGC>* _obj_array_regions;
 
   // Returns whether the given humongous object defined by the start region index
   // is reclaimable.
@@ -369,20 +371,22 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
   // So there is no need to re-check remembered set size of the humongous region.
   //
   // Other implementation considerations:
-  // - never consider object arrays at this time because they would pose
-  // considerable effort for cleaning up the remembered sets. This is
-  // required because stale remembered sets might reference locations that
-  // are currently allocated into.
+  // - remembered set entries from object arrays in other regions become stale.
+  // This is the same as for any other freed region.
+  // - cards of object arrays may have been logged during evacuation and are
+  // redirtied concurrently to this task. Clear their card table after all
+  // post evacuation work completed to not leave dirty cards in free regions.
   bool is_reclaimable(uint region_idx) const {
     return G1CollectedHeap::heap()->is_humongous_reclaim_candidate(region_idx);
   }
 
 public:
-  G1FreeHumongousRegionClosure() :
+  G1FreeHumongousRegionClosure(GrowableArrayCHeap<G1HeapRegion*, mtGC>* obj_array_regions) :
     _humongous_objects_reclaimed(0),
     _humongous_regions_reclaimed(0),
     _freed_bytes(0),
-    _g1h(G1CollectedHeap::heap())
+    _g1h(G1CollectedHeap::heap()),
+    _obj_array_regions(obj_array_regions)
   {}
 
   bool do_heap_region_index(uint region_index) override {
@@ -393,9 +397,10 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
     G1HeapRegion* r = _g1h->region_at(region_index);
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || obj->is_objArray(),
+              "Only eagerly reclaiming arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
+    bool const is_obj_array = obj->is_objArray();
 
     log_debug(gc, humongous)("Reclaimed humongous region %u (object size %zu @ " PTR_FORMAT ")",
                              region_index,
@@ -417,6 +422,9 @@ class G1FreeHumongousRegionClosure : public G1HeapRegionIndexClosure {
       _humongous_regions_reclaimed++;
       G1HeapRegionPrinter::eager_reclaim(r);
       _g1h->free_humongous_region(r, nullptr);
+      if (is_obj_array) {
+        _obj_array_regions->append(r);
+      }
     };
 
     _g1h->humongous_obj_regions_iterate(r, free_humongous_region);
@@ -450,25 +458,33 @@ class G1PostEvacuateCollectionSetCleanupTask2::UpdateDerivedPointersTask : publi
 class G1PostEvacuateCollectionSetCleanupTask2::EagerlyReclaimHumongousObjectsTask : public G1AbstractSubTask {
   uint _humongous_regions_reclaimed;
   size_t _bytes_freed;
+  // Regions of reclaimed object arrays which card table needs to be cleared
+  // after redirtying logged cards.
+  GrowableArrayCHeap<G1HeapRegion*, mtGC> _obj_array_regions;
 
 public:
   EagerlyReclaimHumongousObjectsTask() :
     G1AbstractSubTask(G1GCPhaseTimes::EagerlyReclaimHumongousObjects),
     _humongous_regions_reclaimed(0),
-    _bytes_freed(0) { }
+    _bytes_freed(0),
+    _obj_array_regions() { }
 
   virtual ~EagerlyReclaimHumongousObjectsTask() {
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
     g1h->remove_from_old_gen_sets(0, _humongous_regions_reclaimed);
     g1h->decrement_summary_bytes(_bytes_freed);
+
+    for (G1HeapRegion* r : _obj_array_regions) {
+      r->clear_cardtable();
+    }
   }
 
   double worker_cost() const override { return 1.0; }
   void do_work(uint worker_id) override {
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
-    G1FreeHumongousRegionClosure cl;
+    G1FreeHumongousRegionClosure cl(&_obj_array_regions);
     g1h->heap_region_iterate(&cl);
 
     record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumTotal, g1h->num_humongous_objects());
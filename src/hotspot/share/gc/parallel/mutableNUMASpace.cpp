@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2006, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2006, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,8 +36,15 @@
 #include "runtime/os.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
-
-MutableNUMASpace::MutableNUMASpace(size_t alignment) : MutableSpace(alignment), _must_use_large_pages(false) {
+#include "utilities/powerOfTwo.hpp"
+
+MutableNUMASpace::MutableNUMASpace(size_t alignment) :
+  MutableSpace(alignment),
+  _must_use_large_pages(false),
+  _lgrp_space_index_table(nullptr),
+  _lgrp_space_index_table_capacity(0),
+  _lgrp_space_index_table_base(nullptr),
+  _lgrp_space_index_table_shift(0) {
   _lgrp_spaces = new (mtGC) GrowableArray<LGRPSpace*>(0, mtGC);
   _page_size = os::vm_page_size();
   _adaptation_cycles = 0;
@@ -71,6 +78,7 @@ MutableNUMASpace::~MutableNUMASpace() {
     delete lgrp_spaces()->at(i);
   }
   delete lgrp_spaces();
+  FREE_C_HEAP_ARRAY(uint8_t, _lgrp_space_index_table);
 }
 
 #ifndef PRODUCT
@@ -133,6 +141,31 @@ int MutableNUMASpace::lgrp_space_index(int lgrp_id) const {
   });
 }
 
+void MutableNUMASpace::update_lgrp_space_index_table() {
+  if (!PSNUMAPromotionLABs || lgrp_spaces()->length() > UINT8_MAX) {
+    return;
+  }
+
+  HeapWord* const base = align_down(bottom(), page_size());
+  const size_t length = pointer_delta(align_up(end(), page_size()), base, sizeof(char)) / page_size();
+  if (length > _lgrp_space_index_table_capacity) {
+    FREE_C_HEAP_ARRAY(uint8_t, _lgrp_space_index_table);
+    _lgrp_space_index_table = NEW_C_HEAP_ARRAY(uint8_t, length, mtGC);
+    _lgrp_space_index_table_capacity = length;
+  }
+  _lgrp_space_index_table_base = base;
+  _lgrp_space_index_table_shift = exact_log2(page_size());
+
+  for (int i = 0; i < lgrp_spaces()->length(); i++) {
+    MutableSpace* const s = lgrp_spaces()->at(i)->space();
+    const size_t beg_page = pointer_delta(s->bottom(), base, sizeof(char)) / page_size();
+    const size_t end_page = pointer_delta(align_up(s->end(), page_size()), base, sizeof(char)) / page_size();
+    for (size_t page = beg_page; page < end_page; page++) {
+      _lgrp_space_index_table[page] = checked_cast<uint8_t>(i);
+    }
+  }
+}
+
 size_t MutableNUMASpace::tlab_capacity(Thread *thr) const {
   guarantee(thr != nullptr, "No thread");
   int lgrp_id = thr->lgrp_id();
@@ -489,6 +522,8 @@ void MutableNUMASpace::initialize(MemRegion mr,
 
     set_adaptation_cycles(samples_count());
   }
+
+  update_lgrp_space_index_table();
 }
 
 // Set the top of the whole space.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2006, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2006, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -124,6 +124,16 @@ class MutableNUMASpace : public MutableSpace {
 
   bool _must_use_large_pages;
 
+  // With PSNUMAPromotionLABs, the index of the lgrp space containing each
+  // page of the space, starting with the page containing bottom(). The lgrp
+  // spaces are page aligned, so that every page belongs to one of them.
+  uint8_t* _lgrp_space_index_table;
+  size_t _lgrp_space_index_table_capacity;
+  HeapWord* _lgrp_space_index_table_base;
+  int _lgrp_space_index_table_shift;
+
+  void update_lgrp_space_index_table();
+
   void set_page_size(size_t psz)                     { _page_size = psz;          }
   size_t page_size() const                           { return _page_size;         }
 
@@ -156,6 +166,14 @@ class MutableNUMASpace : public MutableSpace {
 
 public:
   GrowableArray<LGRPSpace*>* lgrp_spaces() const     { return _lgrp_spaces;       }
+  // Return the index of the lgrp space containing p, or -1 if p is not in
+  // the space or the lgrp space index table is not maintained.
+  int lgrp_space_index_containing(const void* p) const {
+    if (_lgrp_space_index_table == nullptr || !contains(p)) {
+      return -1;
+    }
+    return _lgrp_space_index_table[pointer_delta(p, _lgrp_space_index_table_base, 1) >> _lgrp_space_index_table_shift];
+  }
   MutableNUMASpace(size_t alignment);
   virtual ~MutableNUMASpace();
   // Space initialization.
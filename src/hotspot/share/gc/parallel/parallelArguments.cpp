@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2017, Red Hat, Inc. and/or its affiliates.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -91,6 +91,12 @@ void ParallelArguments::initialize() {
     }
   }
 
+  if (PSNUMAPromotionLABs && AlwaysPreTouch) {
+    // All old gen pages are touched up front, so their placement is fixed.
+    log_warning(gc)("PSNUMAPromotionLABs has no effect with AlwaysPreTouch, disabling");
+    FLAG_SET_DEFAULT(PSNUMAPromotionLABs, false);
+  }
+
   if (FLAG_IS_DEFAULT(ParallelRefProcEnabled) && ParallelGCThreads > 1) {
     FLAG_SET_DEFAULT(ParallelRefProcEnabled, true);
   }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,7 +41,13 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, PSNUMAPromotionLABs, false, EXPERIMENTAL,                   \
+          "With UseNUMA, promote objects from each eden NUMA chunk into "   \
+          "separate old generation LABs. Old generation pages that have "   \
+          "never been used before are placed on the NUMA node of that "     \
+          "chunk. Has no effect with AlwaysPreTouch")
 
 // end of GC_PARALLEL_FLAGS
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 #include "utilities/spinYield.hpp"
@@ -110,6 +111,18 @@ void PSCardTable::scan_obj_with_limit(PSPromotionManager* pm,
 
 void PSCardTable::pre_scavenge(uint active_workers) {
   _preprocessing_active_workers = active_workers;
+  _scavenging_active_workers = active_workers;
+  _claimed_stripes = 0;
+
+  // Claim enough stripes at once to contain about a stripe worth of dirty cards,
+  // judging from the previous scavenge. Dense stripes are claimed one at a time
+  // to balance the work, sparse stripes in batches to reduce contention.
+  if (_scavenged_cards > 0) {
+    const size_t stripes_per_claim = _scavenged_cards / MAX2(_scavenged_dirty_cards, (size_t)1);
+    _stripes_per_claim = clamp(stripes_per_claim, (size_t)1, max_stripes_per_claim);
+  }
+  _scavenged_dirty_cards = 0;
+  _scavenged_cards = 0;
 }
 
 // The "shadow" table is a copy of the card table entries of the current stripe.
@@ -210,14 +223,15 @@ class PSStripeShadowCardTable {
 };
 
 template <typename Func>
-void PSCardTable::process_range(Func&& object_start,
-                                PSPromotionManager* pm,
-                                HeapWord* const start,
-                                HeapWord* const end) {
+size_t PSCardTable::process_range(Func&& object_start,
+                                  PSPromotionManager* pm,
+                                  HeapWord* const start,
+                                  HeapWord* const end) {
   assert(start < end, "precondition");
   assert(is_card_aligned(start), "precondition");
 
   PSStripeShadowCardTable sct(this, start, end);
+  size_t num_dirty_cards = 0;
 
   // end might not be card-aligned.
   const CardValue* end_card = sct.card_for(end - 1) + 1;
@@ -234,6 +248,7 @@ void PSCardTable::process_range(Func&& object_start,
     }
 
     // Located a non-empty dirty chunk [dirty_l, dirty_r).
+    num_dirty_cards += pointer_delta(dirty_r, dirty_l, sizeof(CardValue));
     HeapWord* addr_l = sct.addr_for(dirty_l);
     HeapWord* addr_r = MIN2(sct.addr_for(dirty_r), end);
 
@@ -272,6 +287,8 @@ void PSCardTable::process_range(Func&& object_start,
     // Finished a dirty chunk.
     pm->drain_stacks_cond_depth();
   }
+
+  return num_dirty_cards;
 }
 
 template <typename Func>
@@ -337,13 +354,18 @@ void PSCardTable::preprocess_card_table_parallel(Func&& object_start,
 //      +===============+        slice 2
 //      ...
 //
-// In this case there are 4 threads, so 4 stripes.  A GC thread first works on
-// its stripe within slice 0 and then moves to its stripe in the next slice
-// until it has exceeded the top of the generation.  The distance to stripe in
-// the next slice is calculated based on the number of stripes. After finishing
-// stripe 0 in slice 0, the thread finds the stripe 0 in slice 1 by adding
-// slice_size_in_words to the start of stripe 0 in slice 0 to get to the start
-// of stripe 0 in slice 1.
+// In this case there are 4 threads, so 4 stripes.  During preprocessing, a GC
+// thread first works on its stripe within slice 0 and then moves to its stripe
+// in the next slice until it has exceeded the top of the generation.  The
+// distance to stripe in the next slice is calculated based on the number of
+// stripes. After finishing stripe 0 in slice 0, the thread finds the stripe 0
+// in slice 1 by adding slice_size_in_words to the start of stripe 0 in slice 0
+// to get to the start of stripe 0 in slice 1.
+//
+// During scavenging, the GC threads instead claim stripes in address order from
+// a shared counter, so that threads finding few dirty cards take over stripes
+// from threads finding many. Consecutive stripes are claimed in batches, whose
+// size adapts to the density of dirty cards in the previous scavenge.
 
 // Scavenging and accesses to the card table are strictly limited to the stripe.
 // In particular scavenging of an object crossing stripe boundaries is shared
@@ -389,18 +411,33 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     spin_yield.wait();
   }
 
-  // Scavenge
+  // Scavenge. Stripes are claimed in increasing address order, which keeps
+  // the object start queries monotonic.
   cached_obj = {nullptr, old_gen_bottom};
   const size_t stripe_size_in_words = num_cards_in_stripe * _card_size_in_words;
-  const size_t slice_size_in_words = stripe_size_in_words * n_stripes;
-  HeapWord* cur_addr = old_gen_bottom + stripe_index * stripe_size_in_words;
-  for (/* empty */; cur_addr < old_gen_top; cur_addr += slice_size_in_words) {
-    HeapWord* const stripe_l = cur_addr;
-    HeapWord* const stripe_r = MIN2(cur_addr + stripe_size_in_words,
-                                    old_gen_top);
-
-    process_range(object_start, pm, stripe_l, stripe_r);
+  const size_t num_stripes = (pointer_delta(old_gen_top, old_gen_bottom) + stripe_size_in_words - 1) / stripe_size_in_words;
+  const size_t stripes_per_claim = _stripes_per_claim;
+  size_t num_dirty_cards = 0;
+  for (;;) {
+    const size_t first_stripe = Atomic::fetch_then_add(&_claimed_stripes, stripes_per_claim, memory_order_relaxed);
+    if (first_stripe >= num_stripes) {
+      break;
+    }
+    const size_t last_stripe = MIN2(first_stripe + stripes_per_claim, num_stripes);
+    for (size_t i = first_stripe; i < last_stripe; i++) {
+      HeapWord* const stripe_l = old_gen_bottom + i * stripe_size_in_words;
+      HeapWord* const stripe_r = MIN2(stripe_l + stripe_size_in_words,
+                                      old_gen_top);
+
+      num_dirty_cards += process_range(object_start, pm, stripe_l, stripe_r);
+    }
+  }
+
+  Atomic::add(&_scavenged_dirty_cards, num_dirty_cards, memory_order_relaxed);
+  if (stripe_index == 0) {
+    _scavenged_cards = num_stripes * num_cards_in_stripe;
   }
+  Atomic::dec(&_scavenging_active_workers);
 }
 
 // This should be called before a scavenge.
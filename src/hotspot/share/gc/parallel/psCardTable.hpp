@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@
 
 #include "gc/shared/cardTable.hpp"
 #include "oops/oop.hpp"
+#include "runtime/atomic.hpp"
 
 class MutableSpace;
 class ObjectStartArray;
@@ -36,8 +37,20 @@ class PSCardTable: public CardTable {
   friend class PSStripeShadowCardTable;
   static constexpr size_t num_cards_in_stripe = 128;
   static_assert(num_cards_in_stripe >= 1, "progress");
+  static constexpr size_t max_stripes_per_claim = 16;
 
   volatile int _preprocessing_active_workers;
+  // Number of workers that have not finished scavenging their stripes yet.
+  volatile int _scavenging_active_workers;
+
+  // Index of the next stripe to be claimed for scavenging.
+  volatile size_t _claimed_stripes;
+  // Number of consecutive stripes claimed at once, adapted to the density of
+  // dirty cards in the previous scavenge.
+  size_t _stripes_per_claim;
+  // Dirty cards and all cards in the stripes scavenged, for adapting the claim size.
+  volatile size_t _scavenged_dirty_cards;
+  size_t _scavenged_cards;
 
   bool is_dirty(CardValue* card) {
     return !is_clean(card);
@@ -57,8 +70,9 @@ class PSCardTable: public CardTable {
                                       uint n_stripes);
 
   // Scavenge contents on dirty cards of the given stripe [start, end).
+  // Returns the number of dirty cards.
   template <typename Func>
-  void process_range(Func&& object_start,
+  size_t process_range(Func&& object_start,
                      PSPromotionManager* pm,
                      HeapWord* const start,
                      HeapWord* const end);
@@ -70,17 +84,28 @@ class PSCardTable: public CardTable {
 
  public:
   PSCardTable(MemRegion whole_heap) : CardTable(whole_heap),
-                                      _preprocessing_active_workers(0) {}
+                                      _preprocessing_active_workers(0),
+                                      _scavenging_active_workers(0),
+                                      _claimed_stripes(0),
+                                      _stripes_per_claim(1),
+                                      _scavenged_dirty_cards(0),
+                                      _scavenged_cards(0) {}
 
   // Scavenge support
   void pre_scavenge(uint active_workers);
-  // Scavenge contents of stripes with the given index.
+  // Preprocess the stripes with the given index, then scavenge contents of
+  // dynamically claimed stripes.
   void scavenge_contents_parallel(ObjectStartArray* start_array,
                                   HeapWord* old_gen_bottom,
                                   HeapWord* old_gen_top,
                                   PSPromotionManager* pm,
                                   uint stripe_index,
                                   uint n_stripes);
+  // Whether no worker parses the old gen below the old gen top at scavenge
+  // start any more in the current scavenge.
+  bool is_scavenging_done() const {
+    return Atomic::load_acquire(&_scavenging_active_workers) == 0;
+  }
 
   bool is_dirty_for_addr(void *addr);
 
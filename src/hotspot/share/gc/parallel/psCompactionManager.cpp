@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -135,6 +135,7 @@ void ParCompactionManager::process_array_chunk(PartialArrayState* state, bool st
   oop obj = state->source();
   PartialArraySplitter::Claim claim =
     _partial_array_splitter.claim(state, &_marking_stack, stolen);
+  PartialArraySplitter::ChunkCostTracker cost(&_partial_array_splitter, claim);
   follow_array(objArrayOop(obj), claim._start, claim._end);
 }
 
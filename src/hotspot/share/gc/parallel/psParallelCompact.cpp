@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -499,28 +499,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
     uint destination_count = split_info.is_split(cur_region)
                              ? split_info.preceding_destination_count()
                              : 0;
-
-    HeapWord* const last_addr = dest_addr + words - 1;
-    const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-    const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-    // Initially assume that the destination regions will be the same and
-    // adjust the value below if necessary.  Under this assumption, if
-    // cur_region == dest_region_2, then cur_region will be compacted
-    // completely into itself.
-    destination_count += cur_region == dest_region_2 ? 0 : 1;
-    if (dest_region_1 != dest_region_2) {
-      // Destination regions differ; adjust destination_count.
-      destination_count += 1;
-      // Data from cur_region will be copied to the start of dest_region_2.
-      _region_data[dest_region_2].set_source_region(cur_region);
-    } else if (is_region_aligned(dest_addr)) {
-      // Data from cur_region will be copied to the start of the destination
-      // region.
-      _region_data[dest_region_1].set_source_region(cur_region);
-    }
-
-    _region_data[cur_region].set_destination_count(destination_count);
+    summarize_region_destination(cur_region, words, dest_addr, destination_count);
     dest_addr += words;
   }
 
@@ -528,6 +507,57 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+void ParallelCompactData::summarize_region_destination(size_t cur_region, size_t words,
+                                                       HeapWord* dest_addr,
+                                                       uint destination_count) {
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+}
+
+size_t ParallelCompactData::live_words_in_regions(size_t beg_region, size_t end_region) const {
+  size_t live_words = 0;
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    live_words += _region_data[cur_region].data_size();
+  }
+  return live_words;
+}
+
+HeapWord* ParallelCompactData::summarize_regions_without_split(size_t beg_region, size_t end_region,
+                                                               HeapWord* dest_addr) {
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    const size_t words = _region_data[cur_region].data_size();
+
+    // Skip empty ones
+    if (words == 0) {
+      continue;
+    }
+
+    _region_data[cur_region].set_destination(dest_addr);
+    summarize_region_destination(cur_region, words, dest_addr, 0);
+    dest_addr += words;
+  }
+  return dest_addr;
+}
+
 #ifdef ASSERT
 void ParallelCompactData::verify_clear() {
   for (uint cur_idx = 0; cur_idx < region_count(); ++cur_idx) {
@@ -865,6 +895,131 @@ bool PSParallelCompact::check_maximum_compaction(size_t total_live_words,
   return false;
 }
 
+// Split [start, end) evenly for a number of workers and return the
+// range for worker_id.
+static void split_regions_for_worker(size_t start, size_t end,
+                                     uint worker_id, uint num_workers,
+                                     size_t* worker_start, size_t* worker_end) {
+  assert(start < end, "precondition");
+  assert(num_workers > 0, "precondition");
+  assert(worker_id < num_workers, "precondition");
+
+  size_t num_regions = end - start;
+  size_t num_regions_per_worker = num_regions / num_workers;
+  size_t remainder = num_regions % num_workers;
+  // The first few workers will get one extra.
+  *worker_start = start + worker_id * num_regions_per_worker
+                  + MIN2(checked_cast<size_t>(worker_id), remainder);
+  *worker_end = *worker_start + num_regions_per_worker
+                + (worker_id < remainder ? 1 : 0);
+}
+
+// Summarizes the old space regions below the dense prefix end as not moving,
+// and the remaining old space regions as compacting into the old space
+// itself. Both never split a region, so every region depends only on the
+// total live words of the regions before it, and the regions are summarized
+// in parallel stripes after a first pass has counted the live words of each
+// stripe. The resulting destination counts and source regions are the
+// region dependencies the compaction phase is driven by.
+class PSSummarizeOldSpaceTask final : public WorkerTask {
+  const size_t _beg_region;
+  const size_t _dense_prefix_region;
+  const size_t _end_region;
+  const uint _num_workers;
+  // Live words at or above the dense prefix end, per worker stripe.
+  size_t* const _stripe_live_words;
+  // Destination of the first live word of each worker stripe.
+  HeapWord** const _stripe_destination;
+  bool _count_pass;
+
+  void stripe(uint worker_id, size_t* beg, size_t* end) const {
+    split_regions_for_worker(_beg_region, _end_region, worker_id, _num_workers, beg, end);
+  }
+
+public:
+  PSSummarizeOldSpaceTask(size_t beg_region, size_t dense_prefix_region, size_t end_region,
+                          uint num_workers) :
+    WorkerTask("PSSummarizeOldSpace task"),
+    _beg_region(beg_region),
+    _dense_prefix_region(dense_prefix_region),
+    _end_region(end_region),
+    _num_workers(num_workers),
+    _stripe_live_words(NEW_C_HEAP_ARRAY(size_t, num_workers, mtGC)),
+    _stripe_destination(NEW_C_HEAP_ARRAY(HeapWord*, num_workers, mtGC)),
+    _count_pass(true) {}
+
+  ~PSSummarizeOldSpaceTask() {
+    FREE_C_HEAP_ARRAY(size_t, _stripe_live_words);
+    FREE_C_HEAP_ARRAY(HeapWord*, _stripe_destination);
+  }
+
+  // Hand out the destinations of the stripes after the count pass, and
+  // return the new top of the space.
+  HeapWord* prepare_summarize_pass(HeapWord* dense_prefix_end) {
+    assert(_count_pass, "invariant");
+    HeapWord* dest_addr = dense_prefix_end;
+    for (uint i = 0; i < _num_workers; i++) {
+      _stripe_destination[i] = dest_addr;
+      dest_addr += _stripe_live_words[i];
+    }
+    _count_pass = false;
+    return dest_addr;
+  }
+
+  void work(uint worker_id) override {
+    ParallelCompactData& sd = PSParallelCompact::summary_data();
+    size_t beg;
+    size_t end;
+    stripe(worker_id, &beg, &end);
+    const size_t compacted_beg = MAX2(beg, _dense_prefix_region);
+
+    if (_count_pass) {
+      const size_t dense_end = MIN2(end, _dense_prefix_region);
+      if (beg < dense_end) {
+        sd.summarize_dense_prefix(sd.region_to_addr(beg), sd.region_to_addr(dense_end));
+      }
+      _stripe_live_words[worker_id] = compacted_beg < end ? sd.live_words_in_regions(compacted_beg, end) : 0;
+    } else if (compacted_beg < end) {
+      HeapWord* const dest_end = sd.summarize_regions_without_split(compacted_beg, end,
+                                                                    _stripe_destination[worker_id]);
+      assert(dest_end == _stripe_destination[worker_id] + _stripe_live_words[worker_id], "must be");
+    }
+  }
+};
+
+void PSParallelCompact::summarize_old_space(HeapWord* dense_prefix_end) {
+  GCTraceTime(Debug, gc, phases) tm("Summarize Old Space", &_gc_timer);
+
+  const SpaceId id = old_space_id;
+  MutableSpace* const old_space = _space_info[id].space();
+  assert(!_space_info[id].split_info().is_valid(), "old space is never split");
+
+  const size_t beg_region = _summary_data.addr_to_region_idx(old_space->bottom());
+  const size_t dense_prefix_region = _summary_data.addr_to_region_idx(dense_prefix_end);
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(old_space->top()));
+  const uint num_workers = ParallelScavengeHeap::heap()->workers().active_workers();
+
+  if (num_workers == 1 || end_region - beg_region < (size_t)num_workers * MinRegionsPerWorkerForParallelSummary) {
+    if (dense_prefix_end != old_space->bottom()) {
+      _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
+    }
+
+    // Compacting objs in [dense_prefix_end, old_space->top())
+    _summary_data.summarize(_space_info[id].split_info(),
+                            dense_prefix_end, old_space->top(), nullptr,
+                            dense_prefix_end, old_space->end(),
+                            _space_info[id].new_top_addr());
+    return;
+  }
+
+  PSSummarizeOldSpaceTask task(beg_region, dense_prefix_region, end_region, num_workers);
+  ParallelScavengeHeap::heap()->workers().run_task(&task);
+  HeapWord* const new_top = task.prepare_summarize_pass(dense_prefix_end);
+  assert(new_top <= old_space->top(), "usage should not grow");
+  ParallelScavengeHeap::heap()->workers().run_task(&task);
+  _space_info[id].set_new_top(new_top);
+}
+
 void PSParallelCompact::summary_phase()
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
@@ -900,16 +1055,13 @@ void PSParallelCompact::summary_phase()
 
     if (dense_prefix_end != old_space->bottom()) {
       fill_dense_prefix_end(id);
-      _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
     }
 
-    // Compacting objs in [dense_prefix_end, old_space->top())
-    _summary_data.summarize(_space_info[id].split_info(),
-                            dense_prefix_end, old_space->top(), nullptr,
-                            dense_prefix_end, old_space->end(),
-                            _space_info[id].new_top_addr());
+    summarize_old_space(dense_prefix_end);
   }
 
+  GCTraceTime(Debug, gc, phases) tm_young("Summarize Young Spaces", &_gc_timer);
+
   // Summarize the remaining spaces in the young gen.  The initial target space
   // is the old gen.  If a space does not fit entirely into the target, then the
   // remainder is compacted into the space itself and that space becomes the new
@@ -1525,25 +1677,6 @@ void PSParallelCompact::adjust_pointers() {
   ParallelScavengeHeap::heap()->workers().run_task(&task);
 }
 
-// Split [start, end) evenly for a number of workers and return the
-// range for worker_id.
-static void split_regions_for_worker(size_t start, size_t end,
-                                     uint worker_id, uint num_workers,
-                                     size_t* worker_start, size_t* worker_end) {
-  assert(start < end, "precondition");
-  assert(num_workers > 0, "precondition");
-  assert(worker_id < num_workers, "precondition");
-
-  size_t num_regions = end - start;
-  size_t num_regions_per_worker = num_regions / num_workers;
-  size_t remainder = num_regions % num_workers;
-  // The first few workers will get one extra.
-  *worker_start = start + worker_id * num_regions_per_worker
-                  + MIN2(checked_cast<size_t>(worker_id), remainder);
-  *worker_end = *worker_start + num_regions_per_worker
-                + (worker_id < remainder ? 1 : 0);
-}
-
 void PSParallelCompact::forward_to_new_addr() {
   GCTraceTime(Info, gc, phases) tm("Forward", &_gc_timer);
   uint nworkers = ParallelScavengeHeap::heap()->workers().active_workers();
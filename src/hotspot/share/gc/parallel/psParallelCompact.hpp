@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -378,6 +378,15 @@ class ParallelCompactData
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Return the live words in the regions [beg_region, end_region).
+  size_t live_words_in_regions(size_t beg_region, size_t end_region) const;
+
+  // Summarize the regions [beg_region, end_region) as compacting to dest_addr,
+  // for a target space that is known to hold all of them, so no region is
+  // split. Return the destination following the last live word.
+  HeapWord* summarize_regions_without_split(size_t beg_region, size_t end_region,
+                                            HeapWord* dest_addr);
+
   void clear_range(size_t beg_region, size_t end_region);
 
   // Return the number of words between addr and the start of the region
@@ -399,6 +408,12 @@ class ParallelCompactData
 #endif  // #ifdef ASSERT
 
 private:
+  // Record the destination count of cur_region, whose words live words are
+  // compacted to dest_addr, and make it the source region of the destination
+  // region it starts filling, if any.
+  void summarize_region_destination(size_t cur_region, size_t words,
+                                    HeapWord* dest_addr, uint destination_count);
+
   bool initialize_region_data(size_t heap_size);
   PSVirtualSpace* create_vspace(size_t count, size_t element_size);
 
@@ -697,6 +712,10 @@ class PSParallelCompact : AllStatic {
   };
 
 private:
+  // The old space is summarized in parallel if each worker gets at least
+  // this many regions.
+  static const size_t MinRegionsPerWorkerForParallelSummary = 256;
+
   static STWGCTimer           _gc_timer;
   static ParallelOldTracer    _gc_tracer;
   static elapsedTimer         _accumulated_time;
@@ -739,6 +758,10 @@ class PSParallelCompact : AllStatic {
   // make the heap parsable.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Summarize the dense prefix and the rest of the old space, which is
+  // compacted into itself.
+  static void summarize_old_space(HeapWord* dense_prefix_end);
+
   static void summary_phase();
 
   static void adjust_pointers();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2002, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2002, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,11 +23,14 @@
  */
 
 #include "classfile/javaClasses.inline.hpp"
+#include "gc/parallel/mutableNUMASpace.hpp"
 #include "gc/parallel/mutableSpace.hpp"
 #include "gc/parallel/parallelScavengeHeap.hpp"
+#include "gc/parallel/psCardTable.hpp"
 #include "gc/parallel/psOldGen.hpp"
 #include "gc/parallel/psPromotionManager.inline.hpp"
 #include "gc/parallel/psScavenge.inline.hpp"
+#include "gc/parallel/psYoungGen.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/partialArraySplitter.inline.hpp"
@@ -43,13 +46,23 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/checkedCast.hpp"
+#include "utilities/spinYield.hpp"
 
 PaddedEnd<PSPromotionManager>* PSPromotionManager::_manager_array = nullptr;
 PSPromotionManager::PSScannerTasksQueueSet* PSPromotionManager::_stack_array_depth = nullptr;
 PreservedMarksSet*             PSPromotionManager::_preserved_marks_set = nullptr;
 PSOldGen*                      PSPromotionManager::_old_gen = nullptr;
 MutableSpace*                  PSPromotionManager::_young_space = nullptr;
+HeapWord*                      PSPromotionManager::_old_gen_touched_end = nullptr;
+PSPromotionManager::NUMAOldLABChunk* PSPromotionManager::_numa_old_lab_chunks = nullptr;
+uint                           PSPromotionManager::_num_numa_old_lab_chunks = 0;
+Mutex*                         PSPromotionManager::_numa_old_lab_chunks_lock = nullptr;
+uint                           PSPromotionManager::_numa_old_lab_chunks_full_collections = 0;
 PartialArrayStateManager*      PSPromotionManager::_partial_array_state_manager = nullptr;
 
 void PSPromotionManager::initialize() {
@@ -64,6 +77,11 @@ void PSPromotionManager::initialize() {
   _partial_array_state_manager
     = new PartialArrayStateManager(promotion_manager_num);
 
+  // The promotion managers set up their NUMA old LABs for these chunks.
+  if (UseNUMA && PSNUMAPromotionLABs) {
+    initialize_numa_old_lab_chunks();
+  }
+
   // To prevent false sharing, we pad the PSPromotionManagers
   // and make sure that the first instance starts at a cache line.
   assert(_manager_array == nullptr, "Attempt to initialize twice");
@@ -111,6 +129,8 @@ void PSPromotionManager::pre_scavenge() {
 
   _preserved_marks_set->assert_empty();
   _young_space = heap->young_gen()->to_space();
+  _old_gen_touched_end = MAX2(_old_gen_touched_end, old_gen()->object_space()->top());
+  pre_scavenge_numa_old_lab_chunks();
 
   for(uint i=0; i<ParallelGCThreads; i++) {
     manager_array(i)->reset();
@@ -131,6 +151,7 @@ bool PSPromotionManager::post_scavenge(YoungGCTracer& gc_tracer) {
     manager->flush_labs();
     manager->flush_string_dedup_requests();
   }
+  post_scavenge_numa_old_lab_chunks();
   // All PartialArrayStates have been returned to the allocator, since the
   // claimed_stack_depths are all empty.  Leave them there for use by future
   // collections.
@@ -166,11 +187,16 @@ PartialArrayTaskStats* PSPromotionManager::partial_array_task_stats() {
 
 // Most members are initialized either by initialize() or reset().
 PSPromotionManager::PSPromotionManager()
-  : _partial_array_splitter(_partial_array_state_manager, ParallelGCThreads, ParGCArrayScanChunk)
+  : _numa_old_labs(nullptr),
+    _partial_array_splitter(_partial_array_state_manager, ParallelGCThreads, ParGCArrayScanChunk)
 {
   // We set the old lab's start array.
   _old_lab.set_start_array(old_gen()->start_array());
 
+  if (_numa_old_lab_chunks != nullptr) {
+    initialize_numa_old_labs();
+  }
+
   if (ParallelGCThreads == 1) {
     _target_stack_size = 0;
   } else {
@@ -197,11 +223,187 @@ void PSPromotionManager::reset() {
 
   lab_base = old_gen()->object_space()->top();
   _old_lab.initialize(MemRegion(lab_base, (size_t)0));
+  for (uint i = 0; _numa_old_labs != nullptr && i < _num_numa_old_lab_chunks; i++) {
+    _numa_old_labs[i].initialize(MemRegion(lab_base, (size_t)0));
+  }
   _old_gen_is_full = false;
 
   _promotion_failed_info.reset();
 }
 
+void PSPromotionManager::initialize_numa_old_lab_chunks() {
+  MutableNUMASpace* const eden = static_cast<MutableNUMASpace*>(ParallelScavengeHeap::young_gen()->eden_space());
+  const uint num_chunks = (uint)eden->lgrp_spaces()->length();
+  if (num_chunks < 2 || num_chunks > UINT8_MAX) {
+    // Nothing to separate, or more lgrp spaces than the eden lgrp space
+    // index table can tell apart.
+    return;
+  }
+
+  _numa_old_lab_chunks = NEW_C_HEAP_ARRAY(NUMAOldLABChunk, num_chunks, mtGC);
+  for (uint i = 0; i < num_chunks; i++) {
+    NUMAOldLABChunk* const chunk = &_numa_old_lab_chunks[i];
+    chunk->_top = nullptr;
+    chunk->_end = nullptr;
+    chunk->_kept_top = nullptr;
+    chunk->_kept_end = nullptr;
+    chunk->_refilling = false;
+    chunk->_lgrp_id = (int)eden->lgrp_spaces()->at(i)->lgrp_id();
+  }
+  _num_numa_old_lab_chunks = num_chunks;
+  _numa_old_lab_chunks_lock = new PaddedMutex(Mutex::nosafepoint, "PSNUMAOldLABChunks_lock");
+}
+
+void PSPromotionManager::initialize_numa_old_labs() {
+  _numa_old_labs = NEW_C_HEAP_ARRAY(PSOldPromotionLAB, _num_numa_old_lab_chunks, mtGC);
+  for (uint i = 0; i < _num_numa_old_lab_chunks; i++) {
+    ::new (&_numa_old_labs[i]) PSOldPromotionLAB();
+    _numa_old_labs[i].set_start_array(old_gen()->start_array());
+  }
+}
+
+void PSPromotionManager::pre_scavenge_numa_old_lab_chunks() {
+  if (_numa_old_lab_chunks == nullptr ||
+      _numa_old_lab_chunks_full_collections == ParallelScavengeHeap::heap()->total_full_collections()) {
+    return;
+  }
+  // A full collection has compacted the old gen since the rests were kept.
+  for (uint i = 0; i < _num_numa_old_lab_chunks; i++) {
+    _numa_old_lab_chunks[i]._kept_top = nullptr;
+    _numa_old_lab_chunks[i]._kept_end = nullptr;
+  }
+}
+
+void PSPromotionManager::post_scavenge_numa_old_lab_chunks() {
+  if (_numa_old_lab_chunks == nullptr) {
+    return;
+  }
+  for (uint i = 0; i < _num_numa_old_lab_chunks; i++) {
+    NUMAOldLABChunk* const chunk = &_numa_old_lab_chunks[i];
+    assert(!chunk->_refilling, "must be");
+    if (chunk->_top == chunk->_end) {
+      continue;
+    }
+    // Fill the unused rest of the chunk the same way as the rest of a LAB,
+    // which keeps the old gen parsable.
+    PSOldPromotionLAB lab;
+    lab.set_start_array(old_gen()->start_array());
+    lab.initialize(MemRegion(chunk->_top, chunk->_end));
+    lab.flush();
+    // Keep the larger of this rest and the rest kept before, which has not
+    // been taken up in this scavenge and is still filled.
+    if (pointer_delta(chunk->_end, chunk->_top) > pointer_delta(chunk->_kept_end, chunk->_kept_top)) {
+      chunk->_kept_top = chunk->_top;
+      chunk->_kept_end = chunk->_end;
+    }
+    chunk->_top = nullptr;
+    chunk->_end = nullptr;
+  }
+  _numa_old_lab_chunks_full_collections = ParallelScavengeHeap::heap()->total_full_collections();
+}
+
+static size_t numa_page_size() {
+  return UseLargePages ? os::large_page_size() : os::vm_page_size();
+}
+
+// The number of OldPLABSize LABs that a NUMA old LAB chunk holds at least.
+static const size_t NUMAOldLABChunkLABs = 64;
+
+bool PSPromotionManager::allocate_numa_old_lab_chunk(int lgrp_id, HeapWord** base, size_t* chunk_size) {
+  const size_t page_size = numa_page_size();
+  size_t size = MAX2(NUMAOldLABChunkLABs * OldPLABSize, 4 * page_size / HeapWordSize);
+  HeapWord* start = old_gen()->allocate(size);
+  if (start == nullptr) {
+    // Use the remaining old gen space without placing it.
+    size = OldPLABSize;
+    start = old_gen()->allocate(size);
+    if (start == nullptr) {
+      return false;
+    }
+  } else if (start >= _old_gen_touched_end) {
+    // Only whole pages that have never been touched can be placed. This can
+    // not be done for memory below _old_gen_touched_end, e.g. memory freed
+    // up by a full GC.
+    char* const page_start = align_up((char*)start, page_size);
+    char* const page_end = align_down((char*)(start + size), page_size);
+    if (page_start < page_end) {
+      os::numa_make_local(page_start, pointer_delta(page_end, page_start, sizeof(char)), lgrp_id);
+    }
+  }
+  *base = start;
+  *chunk_size = size;
+  return true;
+}
+
+HeapWord* PSPromotionManager::take_numa_old_lab(NUMAOldLABChunk* chunk, size_t* lab_size) {
+  assert_lock_strong(_numa_old_lab_chunks_lock);
+  assert(chunk->_top != chunk->_end, "chunk is empty");
+  // Hand out the rest of the chunk with the last LAB, so that no part
+  // of the chunk smaller than OldPLABSize is left over.
+  const size_t remaining = pointer_delta(chunk->_end, chunk->_top);
+  const size_t size = remaining < 2 * OldPLABSize ? remaining : OldPLABSize;
+  HeapWord* const base = chunk->_top;
+  chunk->_top += size;
+  *lab_size = size;
+  return base;
+}
+
+HeapWord* PSPromotionManager::allocate_numa_old_lab(PSOldPromotionLAB* lab, size_t* lab_size) {
+  const size_t index = pointer_delta(lab, _numa_old_labs, sizeof(PSOldPromotionLAB));
+  assert(index < _num_numa_old_lab_chunks, "Not a NUMA old LAB");
+  NUMAOldLABChunk* const chunk = &_numa_old_lab_chunks[index];
+  PSCardTable* const card_table = ParallelScavengeHeap::heap()->card_table();
+
+  SpinYield spin_yield;
+  for (;;) {
+    {
+      MutexLocker ml(_numa_old_lab_chunks_lock, Mutex::_no_safepoint_check_flag);
+      if (chunk->_top == chunk->_end && chunk->_kept_top != chunk->_kept_end &&
+          card_table->is_scavenging_done()) {
+        // The kept rest lies below the old gen top at scavenge start, and
+        // can only be written once the old-to-young scan is done.
+        chunk->_top = chunk->_kept_top;
+        chunk->_end = chunk->_kept_end;
+        chunk->_kept_top = nullptr;
+        chunk->_kept_end = nullptr;
+      }
+      if (chunk->_top != chunk->_end) {
+        return take_numa_old_lab(chunk, lab_size);
+      }
+      if (!chunk->_refilling) {
+        chunk->_refilling = true;
+        break;
+      }
+    }
+    // Another promotion manager is allocating a new chunk.
+    spin_yield.wait();
+  }
+
+  // Allocate the new chunk outside of the lock, as expanding the old gen
+  // takes PSOldGenExpand_lock and placing the pages is a system call.
+  HeapWord* base = nullptr;
+  size_t chunk_size = 0;
+  const bool success = allocate_numa_old_lab_chunk(chunk->_lgrp_id, &base, &chunk_size);
+
+  MutexLocker ml(_numa_old_lab_chunks_lock, Mutex::_no_safepoint_check_flag);
+  chunk->_refilling = false;
+  if (!success) {
+    return nullptr;
+  }
+  chunk->_top = base;
+  chunk->_end = base + chunk_size;
+  return take_numa_old_lab(chunk, lab_size);
+}
+
+void PSPromotionManager::flush_numa_old_labs() {
+  for (uint i = 0; _numa_old_labs != nullptr && i < _num_numa_old_lab_chunks; i++) {
+    PSOldPromotionLAB* const lab = &_numa_old_labs[i];
+    if (!lab->is_flushed()) {
+      lab->flush();
+    }
+  }
+}
+
 void PSPromotionManager::register_preserved_marks(PreservedMarks* preserved_marks) {
   assert(_preserved_marks == nullptr, "do not set it twice");
   _preserved_marks = preserved_marks;
@@ -250,6 +452,8 @@ void PSPromotionManager::flush_labs() {
   if (!_old_lab.is_flushed())
     _old_lab.flush();
 
+  flush_numa_old_labs();
+
   // Let PSScavenge know if we overflowed
   if (_young_gen_is_full) {
     PSScavenge::set_survivor_overflow(true);
@@ -273,6 +477,7 @@ void PSPromotionManager::process_array_chunk(PartialArrayState* state, bool stol
   oop new_obj = state->destination();
   PartialArraySplitter::Claim claim =
     _partial_array_splitter.claim(state, &_claimed_stack_depth, stolen);
+  PartialArraySplitter::ChunkCostTracker cost(&_partial_array_splitter, claim);
   int start = checked_cast<int>(claim._start);
   int end = checked_cast<int>(claim._end);
   if (UseCompressedOops) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2002, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2002, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,6 +50,7 @@
 //
 
 class MutableSpace;
+class Mutex;
 class PSOldGen;
 class ParCompactionManager;
 
@@ -66,6 +67,35 @@ class PSPromotionManager {
   static PreservedMarksSet*             _preserved_marks_set;
   static PSOldGen*                      _old_gen;
   static MutableSpace*                  _young_space;
+  // With PSNUMAPromotionLABs, the highest old gen top seen at the start of
+  // any scavenge. The pages above have not been touched yet.
+  static HeapWord*                      _old_gen_touched_end;
+
+  // An old gen chunk that the NUMA old LABs of all promotion managers for
+  // one NUMA node are refilled from. The pages of a chunk are placed once,
+  // when the chunk is allocated, rather than for every LAB. The unused rest
+  // of a chunk is filled at the end of a scavenge but kept, and the next
+  // scavenge takes it up again once the old-to-young scan no longer parses
+  // the old gen.
+  struct NUMAOldLABChunk {
+    HeapWord* _top;
+    HeapWord* _end;
+    // The unused rest of a chunk of an earlier scavenge.
+    HeapWord* _kept_top;
+    HeapWord* _kept_end;
+    // Whether a promotion manager is allocating a new chunk.
+    bool      _refilling;
+    int       _lgrp_id;
+  };
+
+  // With PSNUMAPromotionLABs, one chunk per eden lgrp space, shared by all
+  // promotion managers and protected by _numa_old_lab_chunks_lock.
+  static NUMAOldLABChunk*               _numa_old_lab_chunks;
+  static uint                           _num_numa_old_lab_chunks;
+  static Mutex*                         _numa_old_lab_chunks_lock;
+  // The number of full collections when the chunk rests were kept. A full
+  // collection invalidates them.
+  static uint                           _numa_old_lab_chunks_full_collections;
 
 #if TASKQUEUE_STATS
   static void print_and_reset_taskqueue_stats();
@@ -74,6 +104,9 @@ class PSPromotionManager {
 
   PSYoungPromotionLAB                 _young_lab;
   PSOldPromotionLAB                   _old_lab;
+  // With PSNUMAPromotionLABs, one old LAB per eden lgrp space, used for
+  // objects promoted from that lgrp space.
+  PSOldPromotionLAB*                  _numa_old_labs;
   bool                                _young_gen_is_full;
   bool                                _old_gen_is_full;
 
@@ -96,6 +129,21 @@ class PSPromotionManager {
 
   inline static PSPromotionManager* manager_array(uint index);
 
+  static void initialize_numa_old_lab_chunks();
+  static void pre_scavenge_numa_old_lab_chunks();
+  static void post_scavenge_numa_old_lab_chunks();
+  // Allocate a new chunk from the old gen and place its untouched pages.
+  static bool allocate_numa_old_lab_chunk(int lgrp_id, HeapWord** base, size_t* chunk_size);
+  static HeapWord* take_numa_old_lab(NUMAOldLABChunk* chunk, size_t* lab_size);
+
+  void initialize_numa_old_labs();
+  inline PSOldPromotionLAB* old_lab_for(oop obj);
+  // Allocate the memory for refilling a NUMA old LAB from its chunk, which
+  // is refilled first if necessary. Returns the base and sets lab_size, or
+  // returns null if the old gen is full.
+  HeapWord* allocate_numa_old_lab(PSOldPromotionLAB* lab, size_t* lab_size);
+  void flush_numa_old_labs();
+
   template <class T> void  process_array_chunk_work(oop obj,
                                                     int start, int end);
   void process_array_chunk(PartialArrayState* state, bool stolen);
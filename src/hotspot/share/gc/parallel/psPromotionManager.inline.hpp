@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2002, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2002, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,12 +27,14 @@
 
 #include "gc/parallel/psPromotionManager.hpp"
 
+#include "gc/parallel/mutableNUMASpace.hpp"
 #include "gc/parallel/parallelScavengeHeap.hpp"
 #include "gc/parallel/parMarkBitMap.inline.hpp"
 #include "gc/parallel/psOldGen.hpp"
 #include "gc/parallel/psPromotionLAB.inline.hpp"
 #include "gc/parallel/psScavenge.inline.hpp"
 #include "gc/parallel/psStringDedup.hpp"
+#include "gc/parallel/psYoungGen.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
@@ -153,6 +155,17 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
   }
 }
 
+inline PSOldPromotionLAB* PSPromotionManager::old_lab_for(oop obj) {
+  if (_numa_old_labs != nullptr) {
+    MutableNUMASpace* const eden = static_cast<MutableNUMASpace*>(ParallelScavengeHeap::young_gen()->eden_space());
+    const int i = eden->lgrp_space_index_containing(obj);
+    if (i >= 0) {
+      return &_numa_old_labs[i];
+    }
+  }
+  return &_old_lab;
+}
+
 //
 // This method is pretty bulky. It would be nice to split it up
 // into smaller submethods, but we need to be careful not to hurt
@@ -165,6 +178,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
 
   oop new_obj = nullptr;
   bool new_obj_is_tenured = false;
+  PSOldPromotionLAB* old_lab = nullptr;
 
   // NOTE: With compact headers, it is not safe to load the Klass* from old, because
   // that would access the mark-word, that might change at any time by concurrent
@@ -219,7 +233,8 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
     }
 #endif  // #ifndef PRODUCT
 
-    new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
+    old_lab = old_lab_for(o);
+    new_obj = cast_to_oop(old_lab->allocate(new_obj_size));
     new_obj_is_tenured = true;
 
     if (new_obj == nullptr) {
@@ -231,14 +246,16 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
           promotion_trace_event(new_obj, klass, new_obj_size, age, true, nullptr);
         } else {
           // Flush and fill
-          _old_lab.flush();
+          old_lab->flush();
 
-          HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
+          size_t lab_size = OldPLABSize;
+          HeapWord* lab_base = (old_lab == &_old_lab) ? old_gen()->allocate(OldPLABSize)
+                                                      : allocate_numa_old_lab(old_lab, &lab_size);
           if(lab_base != nullptr) {
-            _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+            old_lab->initialize(MemRegion(lab_base, lab_size));
             // Try the old lab allocation again.
-            new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
-            promotion_trace_event(new_obj, klass, new_obj_size, age, true, &_old_lab);
+            new_obj = cast_to_oop(old_lab->allocate(new_obj_size));
+            promotion_trace_event(new_obj, klass, new_obj_size, age, true, old_lab);
           }
         }
       }
@@ -307,7 +324,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
     assert(o->forwardee() == forwardee, "invariant");
 
     if (new_obj_is_tenured) {
-      _old_lab.unallocate_object(cast_from_oop<HeapWord*>(new_obj), new_obj_size);
+      old_lab->unallocate_object(cast_from_oop<HeapWord*>(new_obj), new_obj_size);
     } else {
       _young_lab.unallocate_object(cast_from_oop<HeapWord*>(new_obj), new_obj_size);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2002, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2002, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,7 @@
 #include "gc/shared/workerPolicy.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "gc/shared/workerUtils.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
 #include "memory/resourceArea.hpp"
@@ -129,7 +130,10 @@ static void steal_work(TaskTerminator& terminator, uint worker_id) {
       pm->process_popped_location_depth(task, true);
       pm->drain_stacks_depth(true);
     } else {
-      if (terminator.offer_termination()) {
+      EventGCPhaseParallel event;
+      const bool terminated = terminator.offer_termination();
+      event.commit(GCId::current(), worker_id, "Termination");
+      if (terminated) {
         break;
       }
     }
@@ -273,6 +277,7 @@ class ScavengeRootsTask : public WorkerTask {
       // There are only old-to-young pointers if there are objects
       // in the old gen.
       {
+        EventGCPhaseParallel event;
         PSPromotionManager* pm = PSPromotionManager::gc_thread_promotion_manager(worker_id);
         PSCardTable* card_table = ParallelScavengeHeap::heap()->card_table();
 
@@ -286,9 +291,11 @@ class ScavengeRootsTask : public WorkerTask {
 
         // Do the real work
         pm->drain_stacks(false);
+        event.commit(GCId::current(), worker_id, "Old-To-Young Scan");
       }
     }
 
+    EventGCPhaseParallel roots_event;
     for (uint root_type = 0; _subtasks.try_claim_task(root_type); /* empty */ ) {
       scavenge_roots_work(static_cast<ParallelRootType::Value>(root_type), worker_id);
     }
@@ -304,6 +311,7 @@ class ScavengeRootsTask : public WorkerTask {
       // Do the real work
       pm->drain_stacks(false);
     }
+    roots_event.commit(GCId::current(), worker_id, "Scavenge Roots");
 
     // If active_workers can exceed 1, add a steal_work().
     // PSPromotionManager::drain_stacks_depth() does not fully drain its
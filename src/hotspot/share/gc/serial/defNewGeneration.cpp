@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,7 +26,7 @@
 #include "gc/serial/serialGcRefProcProxyTask.hpp"
 #include "gc/serial/serialHeap.inline.hpp"
 #include "gc/serial/serialStringDedup.inline.hpp"
-#include "gc/serial/tenuredGeneration.hpp"
+#include "gc/serial/tenuredGeneration.inline.hpp"
 #include "gc/shared/adaptiveSizePolicy.hpp"
 #include "gc/shared/ageTable.inline.hpp"
 #include "gc/shared/collectorCounters.hpp"
@@ -52,6 +52,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/threads.hpp"
 #include "utilities/align.hpp"
@@ -424,6 +425,11 @@ void DefNewGeneration::compute_new_size() {
   size_t alignment = Generation::GenGrain;
 
   int threads_count = Threads::number_of_non_daemon_threads();
+  if (SerialContainerAwareNewSize) {
+    // Only as many threads as there are processors can allocate at the same
+    // time, so more threads do not need more young gen to cover a GC interval.
+    threads_count = MIN2(threads_count, os::active_processor_count());
+  }
   size_t thread_increase_size = calculate_thread_increase_size(threads_count);
 
   size_t new_size_candidate = old_size / NewRatio;
@@ -436,6 +442,16 @@ void DefNewGeneration::compute_new_size() {
   desired_new_size = clamp(desired_new_size, min_new_size, max_new_size);
   assert(desired_new_size <= max_new_size, "just checking");
 
+  if (SerialContainerAwareNewSize && desired_new_size > new_size_before) {
+    // Growing the generation commits memory that is touched right away. Do
+    // not grow it by more than the available memory, which follows the
+    // container memory limit.
+    const julong available = os::available_memory();
+    if (available < desired_new_size - new_size_before) {
+      desired_new_size = new_size_before + align_down((size_t)available, alignment);
+    }
+  }
+
   bool changed = false;
   if (desired_new_size > new_size_before) {
     size_t change = desired_new_size - new_size_before;
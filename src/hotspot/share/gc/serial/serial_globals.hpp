@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,12 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(bool, SerialContainerAwareNewSize, false, EXPERIMENTAL,           \
+          "Apply NewSizeThreadIncrease to at most as many non-daemon "      \
+          "threads as there are active processors, and do not grow the "    \
+          "young generation by more than the available memory. Both "      \
+          "respect container limits")                                       \
 
 // end of GC_SERIAL_FLAGS
 
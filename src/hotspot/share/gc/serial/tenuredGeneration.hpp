@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -160,7 +160,10 @@ class TenuredGeneration: public Generation {
   //
   // The "obj_size" argument is just obj->size(), passed along so the caller can
   // avoid repeating the virtual call to retrieve it.
-  oop allocate_for_promotion(oop obj, size_t obj_size);
+  // Promotion bump allocates in the space directly, and only calls out to
+  // the slow path for expanding the generation when the space is full.
+  inline oop allocate_for_promotion(oop obj, size_t obj_size);
+  oop allocate_for_promotion_slow(oop obj, size_t obj_size);
 
   virtual void verify();
   virtual void print_on(outputStream* st) const;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2000, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #include "gc/serial/tenuredGeneration.hpp"
 
 #include "gc/shared/space.hpp"
+#include "oops/oop.inline.hpp"
 
 inline size_t TenuredGeneration::capacity() const {
   return space()->capacity();
@@ -57,4 +58,23 @@ HeapWord* TenuredGeneration::allocate(size_t word_size) {
   return res;
 }
 
+inline oop TenuredGeneration::allocate_for_promotion(oop obj, size_t obj_size) {
+  assert(obj_size == obj->size(), "bad obj_size passed in");
+
+#ifndef PRODUCT
+  if (PromotionFailureALot) {
+    return allocate_for_promotion_slow(obj, obj_size);
+  }
+#endif  // #ifndef PRODUCT
+
+  // The objects promoted in a young collection are found again by walking the
+  // space from its top at the start of the collection, so the space stays
+  // parsable up to its top and promotions go straight to the space.
+  HeapWord* const result = allocate(obj_size);
+  if (result != nullptr) {
+    return cast_to_oop(result);
+  }
+  return allocate_for_promotion_slow(obj, obj_size);
+}
+
 #endif // SHARE_GC_SERIAL_TENUREDGENERATION_INLINE_HPP
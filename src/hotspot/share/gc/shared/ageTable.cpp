@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,9 +37,12 @@
 /* Copyright (c) 1992, 2025, Oracle and/or its affiliates, and Stanford University.
    See the LICENSE file for license information. */
 
-AgeTable::AgeTable(bool global) : _use_perf_data(UsePerfData && global) {
+AgeTable::AgeTable(bool global) : _use_perf_data(UsePerfData && global), _prev_threshold(0) {
 
   clear();
+  for (int age = 0; age < table_size; age++) {
+    _prev_sizes[age] = 0;
+  }
 
   if (_use_perf_data) {
 
@@ -104,8 +107,16 @@ uint AgeTable::compute_tenuring_threshold(size_t desired_survivor_size) {
       age++;
     }
     result = age < MaxTenuringThreshold ? age : MaxTenuringThreshold;
-  }
 
+    if (TenuringSurvivalRatePercent > 0) {
+      uint survival_threshold = survival_rate_tenuring_threshold();
+      if (survival_threshold < result) {
+        log_debug(gc, age)("Survival rate lowers threshold %u to %u", result, survival_threshold);
+        result = survival_threshold;
+      }
+      record_for_survival_rate(result);
+    }
+  }
 
   log_debug(gc, age)("Desired survivor size %zu bytes, new threshold %zu (max threshold %u)",
                      desired_survivor_size * oopSize, (uintx) result, MaxTenuringThreshold);
@@ -113,6 +124,32 @@ uint AgeTable::compute_tenuring_threshold(size_t desired_survivor_size) {
   return result;
 }
 
+uint AgeTable::survival_rate_tenuring_threshold() const {
+  // Objects of age 'age' in the previous collection that survived the current
+  // one have age 'age + 1'. Objects of age 'age' >= previous threshold have
+  // been tenured instead, so the oldest surviving cohort has the age of the
+  // previous threshold.
+  uint result = table_size;
+  uint limit = MIN2(_prev_threshold + 1, (uint)table_size);
+  size_t survived = 0;
+  size_t previous = 0;
+  for (uint age = limit; age-- > 2; ) {
+    survived += sizes[age];
+    previous += _prev_sizes[age - 1];
+    if (previous > 0 && survived * 100 >= previous * TenuringSurvivalRatePercent) {
+      result = age - 1;
+    }
+  }
+  return result;
+}
+
+void AgeTable::record_for_survival_rate(uint threshold) {
+  for (int age = 0; age < table_size; age++) {
+    _prev_sizes[age] = sizes[age];
+  }
+  _prev_threshold = threshold;
+}
+
 void AgeTable::print_age_table() {
   LogTarget(Trace, gc, age) lt;
   if (lt.is_enabled() || _use_perf_data || AgeTableTracer::is_tenuring_distribution_event_enabled()) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,6 +78,17 @@ class AgeTable: public CHeapObj<mtGC> {
  private:
   bool _use_perf_data;
   PerfVariable* _perf_sizes[table_size];
+
+  // Sizes and resulting threshold of the previous call to
+  // compute_tenuring_threshold(), for TenuringSurvivalRatePercent.
+  size_t _prev_sizes[table_size];
+  uint _prev_threshold;
+
+  // The youngest age from which objects have survived the previous
+  // collection at least at TenuringSurvivalRatePercent, or table_size if
+  // there is no such age.
+  uint survival_rate_tenuring_threshold() const;
+  void record_for_survival_rate(uint threshold);
 };
 
 #endif // SHARE_GC_SHARED_AGETABLE_HPP
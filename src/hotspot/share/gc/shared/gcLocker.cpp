@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/threadSMR.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/spinYield.hpp"
 #include "utilities/ticks.hpp"
 
@@ -99,16 +100,45 @@ void GCLocker::block() {
   OrderAccess::fence();
 
   JavaThread* java_thread = JavaThread::current();
-  ThreadBlockInVM tbivm(java_thread);
-
-  // Wait for threads leaving critical section
-  SpinYield spin_yield;
-  for (JavaThreadIteratorWithHandle jtiwh; JavaThread *cur = jtiwh.next(); /* empty */) {
-    while (cur->in_critical_atomic()) {
-      spin_yield.wait();
+  // The handle keeps the threads we waited for alive until they are logged.
+  ThreadsListHandle tlh(java_thread);
+  ResourceMark rm; // JavaThread::name() allocates to convert to UTF8
+
+  // Name the threads that hold up the GC, to help finding the native code
+  // with long critical sections in collectors that cannot pin objects. The
+  // names are resolved after the wait, as reading the thread oops is not
+  // safe while blocked.
+  struct CriticalWait {
+    JavaThread* _thread;
+    Tickspan _time;
+  };
+  const bool log_waits = log_is_enabled(Debug, gc, jni);
+  GrowableArray<CriticalWait> waits;
+
+  {
+    ThreadBlockInVM tbivm(java_thread);
+
+    // Wait for threads leaving critical section
+    SpinYield spin_yield;
+    for (JavaThreadIterator jti(tlh.list()); JavaThread *cur = jti.next(); /* empty */) {
+      if (!cur->in_critical_atomic()) {
+        continue;
+      }
+      const Ticks wait_start = Ticks::now();
+      while (cur->in_critical_atomic()) {
+        spin_yield.wait();
+      }
+      if (log_waits) {
+        waits.append({cur, Ticks::now() - wait_start});
+      }
     }
   }
 
+  for (const CriticalWait& wait : waits) {
+    log_debug(gc, jni)("GC waited " UINT64_FORMAT "ms for thread \"%s\" to leave critical region.",
+                       wait._time.milliseconds(), wait._thread->name());
+  }
+
 #ifdef ASSERT
   // Matching the storestore in GCLocker::exit.
   OrderAccess::loadload();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -153,6 +153,7 @@ bool VM_GC_HeapInspection::doit_prologue() {
     // prologue.
     Universe::heap()->collect(GCCause::_heap_inspection);
   }
+  _buffered = true;
   return VM_GC_Operation::doit_prologue();
 }
 
@@ -187,6 +188,7 @@ void VM_GC_HeapInspection::doit() {
       log_warning(gc)("GC locker is held; pre-dump GC was skipped");
     }
   }
+  outputStream* out = _buffered ? &_buffer : _out;
   HeapInspection inspect;
   WorkerThreads* workers = Universe::heap()->safepoint_workers();
   if (workers != nullptr) {
@@ -194,9 +196,35 @@ void VM_GC_HeapInspection::doit() {
     // Can't run with more threads than provided by the WorkerThreads.
     const uint capped_parallel_thread_num = MIN2(_parallel_thread_num, workers->max_workers());
     WithActiveWorkers with_active_workers(workers, capped_parallel_thread_num);
-    inspect.heap_inspection(_out, workers);
+    inspect.heap_inspection(out, workers);
   } else {
-    inspect.heap_inspection(_out, nullptr);
+    inspect.heap_inspection(out, nullptr);
+  }
+}
+
+void VM_GC_HeapInspection::doit_epilogue() {
+  VM_GC_Operation::doit_epilogue();
+  _buffer.write_to_target();
+}
+
+void HeapInspectionBuffer::write(const char* s, size_t len) {
+  if (!_pass_through && size() + len > BufferCap) {
+    // Stop buffering rather than growing the buffer without bound.
+    write_to_target();
+    _pass_through = true;
+  }
+  if (_pass_through) {
+    _target->write(s, len);
+  } else {
+    bufferedStream::write(s, len);
+  }
+}
+
+void HeapInspectionBuffer::write_to_target() {
+  if (size() > 0) {
+    _target->write(base(), size());
+    _target->flush();
+    reset();
   }
 }
 
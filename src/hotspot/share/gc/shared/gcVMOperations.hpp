@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 #include "runtime/handles.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/vmOperation.hpp"
+#include "utilities/ostream.hpp"
 
 // The following class hierarchy represents
 // a set of operations (VM_Operation) related to GC.
@@ -150,9 +151,31 @@ class VM_GC_Operation: public VM_GC_Sync_Operation {
 };
 
 
+// Buffers output for a target stream. Once the buffered output would
+// exceed the cap, it is written to the target, and so is all later output.
+class HeapInspectionBuffer : public bufferedStream {
+ private:
+  static const size_t BufferCap = 10 * M;
+  outputStream* _target;
+  bool _pass_through;
+ public:
+  HeapInspectionBuffer(outputStream* target) :
+    bufferedStream(), _target(target), _pass_through(false) {}
+  virtual void write(const char* s, size_t len);
+  // Writes the buffered output to the target.
+  void write_to_target();
+};
+
 class VM_GC_HeapInspection: public VM_GC_Operation {
  private:
   outputStream* _out;
+  // When executed by the VM thread, the histogram is printed into this
+  // buffer during the safepoint, and written to _out by the requesting
+  // thread afterwards. The heap walk still runs during the safepoint.
+  HeapInspectionBuffer _buffer;
+  // Set by doit_prologue, i.e., only when executed through VMThread::execute.
+  // Direct callers of doit() get the histogram on _out right away.
+  bool _buffered;
   bool _full_gc;
   uint _parallel_thread_num;
  public:
@@ -161,7 +184,7 @@ class VM_GC_HeapInspection: public VM_GC_Operation {
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_inspection /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
-                    request_full_gc), _out(out), _full_gc(request_full_gc),
+                    request_full_gc), _out(out), _buffer(out), _buffered(false), _full_gc(request_full_gc),
                     _parallel_thread_num(parallel_thread_num) {}
 
   ~VM_GC_HeapInspection() {}
@@ -169,6 +192,7 @@ class VM_GC_HeapInspection: public VM_GC_Operation {
   virtual bool skip_operation() const;
   virtual bool doit_prologue();
   virtual void doit();
+  virtual void doit_epilogue();
  protected:
   bool collect();
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -136,6 +136,13 @@
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
                                                                             \
+  product(uint, GCWorkerSpinBeforeParkMicros, 0, EXPERIMENTAL,              \
+          "Number of microseconds a GC worker thread spins waiting for "    \
+          "the next task during a safepoint before blocking. Reduces the "  \
+          "start latency of short consecutive tasks at the cost of CPU "    \
+          "time. Specify 0 to block immediately.")                          \
+          range(0, 10000)                                                   \
+                                                                            \
   product(size_t, HeapSizePerGCThread, ScaleForWordSize(32*M),              \
           "Size of heap (bytes) per GC thread used in calculating the "     \
           "number of GC threads")                                           \
@@ -177,6 +184,13 @@
           "bigger than this")                                               \
           range(1, INT_MAX/3)                                               \
                                                                             \
+  product(uintx, PartialArrayChunkTargetNanos, 0, EXPERIMENTAL,             \
+          "Adapt the chunk size used for scanning large object arrays so "  \
+          "that processing a chunk takes about this many nanoseconds, "     \
+          "based on the measured processing time of earlier chunks. "       \
+          "Specify 0 to use a fixed chunk size.")                           \
+          range(0, max_uintx)                                               \
+                                                                            \
                                                                             \
   product(bool, AlwaysPreTouch, false,                                      \
           "Force all freshly committed pages to be pre-touched")            \
@@ -204,6 +218,13 @@
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(uint, ParallelRefProcBalancingSkewFactor, 0, EXPERIMENTAL,        \
+          "Balance reference processing queues even if "                    \
+          "ParallelRefProcBalancingEnabled is false when the longest "      \
+          "discovered list has more than this many times the average "      \
+          "number of references. Specify 0 to disable.")                    \
+          range(0, 1000)                                                    \
+                                                                            \
   product(size_t, ReferencesPerThread, 1000, EXPERIMENTAL,                  \
                "Ergonomically start one thread for this amount of "         \
                "references for reference processing if "                    \
@@ -579,6 +600,14 @@
           range(0, markWord::max_age + 1)                                   \
           constraint(InitialTenuringThresholdConstraintFunc,AfterErgo)      \
                                                                             \
+  product(uint, TenuringSurvivalRatePercent, 0, EXPERIMENTAL,               \
+          "Lower the tenuring threshold to the youngest age from which at " \
+          "least this percentage of the surviving objects survived the "    \
+          "previous young collection, to avoid repeatedly copying "         \
+          "long-lived objects between survivor spaces. Specify 0 to "       \
+          "disable.")                                                       \
+          range(0, 100)                                                     \
+                                                                            \
   product(uint, TargetSurvivorRatio,    50,                                 \
           "Desired percentage of survivor space used after scavenge")       \
           range(0, 100)                                                     \
@@ -609,6 +638,16 @@
           "during parallel gc")                                             \
           range(0, 8 * 1024)                                                \
                                                                             \
+  product(uint, GCStealBatchSize, 1, EXPERIMENTAL,                          \
+          "Maximum number of tasks a successful steal takes from the "      \
+          "victim task queue, up to half of the tasks left in that queue. " \
+          "The tasks beyond the first go to the queue of the thief.")       \
+          range(1, 64)                                                      \
+                                                                            \
+  product(bool, GCStealPreferLocalNUMANode, false, EXPERIMENTAL,            \
+          "With UseNUMA, prefer stealing from task queues whose owner "     \
+          "last ran on the NUMA node of the thief")                         \
+                                                                            \
   product(uint, GCCardSizeInBytes, 512,                                     \
           "Card table entry size (in bytes) for card based collectors")     \
           range(128, NOT_LP64(512) LP64_ONLY(1024))                         \
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,41 @@
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/partialArraySplitter.hpp"
 #include "gc/shared/partialArrayState.hpp"
+#include "gc/shared/partialArrayTaskStepper.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 
 PartialArraySplitter::PartialArraySplitter(PartialArrayStateManager* manager,
                                            uint num_workers,
                                            size_t chunk_size)
   : _allocator(manager),
-    _stepper(num_workers, chunk_size)
+    _stepper(num_workers, chunk_size),
+    _nanos_per_element(ChunkCostWeight)
     TASKQUEUE_STATS_ONLY(COMMA _stats())
 {}
 
+size_t PartialArraySplitter::start_chunk_size() const {
+  size_t default_size = _stepper.chunk_size();
+  if ((PartialArrayChunkTargetNanos == 0) ||
+      (_nanos_per_element.count() < MinChunkCostSamples)) {
+    return default_size;
+  }
+  size_t min_size = MAX2(default_size / MaxChunkSizeFactor, (size_t)1);
+  size_t max_size = default_size * MaxChunkSizeFactor;
+  float nanos = _nanos_per_element.average();
+  if (nanos * max_size <= PartialArrayChunkTargetNanos) {
+    return max_size;
+  }
+  return clamp((size_t)(PartialArrayChunkTargetNanos / nanos), min_size, max_size);
+}
+
+void PartialArraySplitter::record_chunk_cost(size_t elements, const Tickspan& elapsed) {
+  assert(elements > 0, "precondition");
+  uint64_t nanos = elapsed.nanoseconds();
+  _nanos_per_element.sample((float)nanos / elements);
+  TASKQUEUE_STATS_ONLY(_stats.inc_chunk_nanos(nanos);)
+}
+
 #if TASKQUEUE_STATS
 PartialArrayTaskStats* PartialArraySplitter::stats() {
   return &_stats;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,23 +25,45 @@
 #ifndef SHARE_GC_SHARED_PARTIALARRAYSPLITTER_HPP
 #define SHARE_GC_SHARED_PARTIALARRAYSPLITTER_HPP
 
+#include "gc/shared/gcUtil.hpp"
 #include "gc/shared/partialArrayState.hpp"
 #include "gc/shared/partialArrayTaskStats.hpp"
 #include "gc/shared/partialArrayTaskStepper.hpp"
+#include "memory/allocation.hpp"
 #include "oops/oop.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/ticks.hpp"
 
 class outputStream;
 
 // Helper class for splitting the processing of a large objArray into multiple
 // tasks, to permit multiple threads to work on different pieces of the array
 // in parallel.
+//
+// If PartialArrayChunkTargetNanos is non-zero, the chunk size used for an
+// array is derived from the processing time per element observed for
+// previously claimed chunks, rather than being fixed.  Arrays with mostly
+// null elements are then split into fewer, larger chunks, while arrays whose
+// elements are expensive to process are split into more, smaller chunks.
 class PartialArraySplitter {
+  // Samples needed before adapting the chunk size.
+  static const uint MinChunkCostSamples = 8;
+  // Bound on how much the adapted chunk size may differ from the default.
+  static const size_t MaxChunkSizeFactor = 16;
+  // Weight of the most recent sample in the per element cost average.
+  static const uint ChunkCostWeight = 25;
+
   PartialArrayStateAllocator _allocator;
   PartialArrayTaskStepper _stepper;
+  AdaptiveWeightedAverage _nanos_per_element;
   TASKQUEUE_STATS_ONLY(PartialArrayTaskStats _stats;)
 
+  // The chunk size to use for an array being started.
+  size_t start_chunk_size() const;
+
+  void record_chunk_cost(size_t elements, const Tickspan& elapsed);
+
 public:
   PartialArraySplitter(PartialArrayStateManager* manager,
                        uint num_workers,
@@ -100,7 +122,25 @@ class PartialArraySplitter {
   template<typename Queue>
   Claim claim(PartialArrayState* state, Queue* queue, bool stolen);
 
+  // Scoped measurement of the processing time of a claimed chunk.
+  class ChunkCostTracker;
+
   TASKQUEUE_STATS_ONLY(PartialArrayTaskStats* stats();)
 };
 
+// Records the time spent in its scope as the cost of processing the claimed
+// chunk, for adapting the chunk size of subsequently started arrays.  Does
+// nothing unless PartialArrayChunkTargetNanos is non-zero.
+class PartialArraySplitter::ChunkCostTracker : public StackObj {
+  PartialArraySplitter* _splitter;
+  size_t _elements;
+  Ticks _start;
+
+public:
+  inline ChunkCostTracker(PartialArraySplitter* splitter, const Claim& claim);
+  inline ~ChunkCostTracker();
+
+  NONCOPYABLE(ChunkCostTracker);
+};
+
 #endif // SHARE_GC_SHARED_PARTIALARRAYSPLITTER_HPP
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@
 
 #include "gc/shared/partialArraySplitter.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/partialArrayTaskStats.hpp"
 #include "gc/shared/partialArrayTaskStepper.inline.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
@@ -40,13 +41,14 @@ size_t PartialArraySplitter::start(Queue* queue,
                                    objArrayOop source,
                                    objArrayOop destination,
                                    size_t length) {
-  PartialArrayTaskStepper::Step step = _stepper.start(length);
+  size_t chunk_size = start_chunk_size();
+  PartialArrayTaskStepper::Step step = _stepper.start(length, chunk_size);
   // Push initial partial scan tasks.
   if (step._ncreate > 0) {
     TASKQUEUE_STATS_ONLY(_stats.inc_split(););
     TASKQUEUE_STATS_ONLY(_stats.inc_pushed(step._ncreate);)
     PartialArrayState* state =
-      _allocator.allocate(source, destination, step._index, length, step._ncreate);
+      _allocator.allocate(source, destination, step._index, length, chunk_size, step._ncreate);
     for (uint i = 0; i < step._ncreate; ++i) {
       queue->push(ScannerTask(state));
     }
@@ -64,6 +66,8 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
   _stats.inc_processed();
 #endif // TASKQUEUE_STATS
 
+  // Access state before release.
+  size_t chunk_size = state->chunk_size();
   // Claim a chunk and get number of additional tasks to enqueue.
   PartialArrayTaskStepper::Step step = _stepper.next(state);
   // Push additional tasks.
@@ -77,7 +81,24 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
   }
   // Release state, decrementing refcount, now that we're done with it.
   _allocator.release(state);
-  return Claim{step._index, step._index + _stepper.chunk_size()};
+  return Claim{step._index, step._index + chunk_size};
+}
+
+PartialArraySplitter::ChunkCostTracker::ChunkCostTracker(PartialArraySplitter* splitter,
+                                                         const Claim& claim)
+  : _splitter(splitter),
+    _elements(claim._end - claim._start),
+    _start()
+{
+  if (PartialArrayChunkTargetNanos > 0) {
+    _start.stamp();
+  }
+}
+
+PartialArraySplitter::ChunkCostTracker::~ChunkCostTracker() {
+  if (PartialArrayChunkTargetNanos > 0) {
+    _splitter->record_chunk_cost(_elements, Ticks::now() - _start);
+  }
 }
 
 #endif // SHARE_GC_SHARED_PARTIALARRAYSPLITTER_INLINE_HPP
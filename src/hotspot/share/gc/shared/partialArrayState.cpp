@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,14 +37,17 @@
 
 PartialArrayState::PartialArrayState(oop src, oop dst,
                                      size_t index, size_t length,
+                                     size_t chunk_size,
                                      size_t initial_refcount)
   : _source(src),
     _destination(dst),
     _length(length),
+    _chunk_size(chunk_size),
     _index(index),
     _refcount(initial_refcount)
 {
   assert(index <= length, "precondition");
+  assert(chunk_size > 0, "precondition");
 }
 
 void PartialArrayState::add_references(size_t count) {
@@ -79,6 +82,7 @@ PartialArrayStateAllocator::~PartialArrayStateAllocator() {
 PartialArrayState* PartialArrayStateAllocator::allocate(oop src, oop dst,
                                                         size_t index,
                                                         size_t length,
+                                                        size_t chunk_size,
                                                         size_t initial_refcount) {
   void* p;
   FreeListEntry* head = _free_list;
@@ -89,7 +93,7 @@ PartialArrayState* PartialArrayStateAllocator::allocate(oop src, oop dst,
     head->~FreeListEntry();
     p = head;
   }
-  return ::new (p) PartialArrayState(src, dst, index, length, initial_refcount);
+  return ::new (p) PartialArrayState(src, dst, index, length, chunk_size, initial_refcount);
 }
 
 void PartialArrayStateAllocator::release(PartialArrayState* state) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -60,6 +60,7 @@ class PartialArrayState {
   oop _source;
   oop _destination;
   size_t _length;
+  size_t _chunk_size;
   volatile size_t _index;
   volatile size_t _refcount;
 
@@ -67,6 +68,7 @@ class PartialArrayState {
 
   PartialArrayState(oop src, oop dst,
                     size_t index, size_t length,
+                    size_t chunk_size,
                     size_t initial_refcount);
 
 public:
@@ -88,6 +90,9 @@ class PartialArrayState {
   // The length of the array oop.
   size_t length() const { return _length; }
 
+  // The number of elements claimed by each task referring to this state.
+  size_t chunk_size() const { return _chunk_size; }
+
   // A pointer to the start index for the next segment to process, for atomic
   // update.
   volatile size_t* index_addr() { return &_index; }
@@ -129,6 +134,7 @@ class PartialArrayStateAllocator : public CHeapObj<mtGC> {
   // from the associated manager.
   PartialArrayState* allocate(oop src, oop dst,
                               size_t index, size_t length,
+                              size_t chunk_size,
                               size_t initial_refcount);
 
   // Decrement the state's refcount.  If the new refcount is zero, add the
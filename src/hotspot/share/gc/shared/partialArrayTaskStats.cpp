@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,7 +34,7 @@
 #if TASKQUEUE_STATS
 
 PartialArrayTaskStats::PartialArrayTaskStats()
-  : _split(0), _pushed(0), _stolen(0), _processed(0)
+  : _split(0), _pushed(0), _stolen(0), _processed(0), _chunk_nanos(0)
 {}
 
 void PartialArrayTaskStats::accumulate(const PartialArrayTaskStats& stats) {
@@ -42,6 +42,7 @@ void PartialArrayTaskStats::accumulate(const PartialArrayTaskStats& stats) {
   _pushed += stats._pushed;
   _stolen += stats._stolen;
   _processed += stats._processed;
+  _chunk_nanos += stats._chunk_nanos;
 }
 
 void PartialArrayTaskStats::reset() {
@@ -58,9 +59,9 @@ bool PartialArrayTaskStats::is_log_enabled() {
 }
 
 static const char* const stats_hdr[] = {
-  "     ----partial array----      arrays      array",
-  "thread       push      steal    chunked     chunks",
-  "------ ---------- ---------- ---------- ----------"
+  "     ----partial array----      arrays      array      chunk",
+  "thread       push      steal    chunked     chunks    time-ns",
+  "------ ---------- ---------- ---------- ---------- ----------"
 };
 
 void PartialArrayTaskStats::print_header(outputStream* s, const char* title) {
@@ -72,8 +73,8 @@ void PartialArrayTaskStats::print_header(outputStream* s, const char* title) {
 
 void PartialArrayTaskStats::print_values_impl(outputStream* s) const {
   // 10 digits for each counter, matching the segments in stats_hdr.
-  s->print_cr(" %10zu %10zu %10zu %10zu",
-              _pushed, _stolen, _split, _processed);
+  s->print_cr(" %10zu %10zu %10zu %10zu %10zu",
+              _pushed, _stolen, _split, _processed, _chunk_nanos);
 }
 
 void PartialArrayTaskStats::print_values(outputStream* s, uint id) const {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,7 @@ class PartialArrayTaskStats {
   size_t _pushed;
   size_t _stolen;
   size_t _processed;
+  size_t _chunk_nanos;
 
   static LogTargetHandle log_target();
   static bool is_log_enabled();
@@ -69,10 +70,15 @@ class PartialArrayTaskStats {
   // Number of partial array tasks processed.
   size_t processed() const { return _processed; }
 
+  // Total time in nanoseconds measured for processing partial array tasks.
+  // Only measured if PartialArrayChunkTargetNanos is non-zero.
+  size_t chunk_nanos() const { return _chunk_nanos; }
+
   void inc_split() { _split += 1; }
   void inc_pushed(size_t n) { _pushed += n; }
   void inc_stolen() { _stolen += 1; }
   void inc_processed() { _processed += 1; }
+  void inc_chunk_nanos(size_t n) { _chunk_nanos += n; }
 
   // Set all counters to zero.
   void reset();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,13 +53,18 @@ class PartialArrayTaskStepper {
   // array.  If _ncreate is zero then _index will be length.
   inline Step start(size_t length) const;
 
-  // Atomically increment state's index by chunk_size() to claim the next
+  // As above, but splitting the array into chunks of the given size rather
+  // than chunk_size().  The same chunk size must be used for all claims
+  // from the state created for the array.
+  inline Step start(size_t length, size_t chunk_size) const;
+
+  // Atomically increment state's index by state's chunk size to claim the next
   // chunk.  Returns a Step with _index being the starting index of the
   // claimed chunk and _ncreate being the number of additional partial tasks
   // to enqueue.
   inline Step next(PartialArrayState* state) const;
 
-  // The size of chunks to claim for each task.
+  // The default size of chunks to claim for each task.
   inline size_t chunk_size() const;
 
   class TestSupport;            // For unit tests
@@ -72,6 +77,10 @@ class PartialArrayTaskStepper {
   // Maximum number of new tasks to create when processing an existing task.
   uint _task_fanout;
 
+  inline Step next_impl(size_t length,
+                        volatile size_t* index_addr,
+                        size_t chunk_size) const;
+
   // For unit tests.
   inline Step next_impl(size_t length, volatile size_t* index_addr) const;
 };
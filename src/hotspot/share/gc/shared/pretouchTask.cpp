@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,16 +34,21 @@ PretouchTask::PretouchTask(const char* task_name,
                            char* start_address,
                            char* end_address,
                            size_t page_size,
-                           size_t chunk_size) :
+                           size_t chunk_size,
+                           size_t chunk_alignment) :
     WorkerTask(task_name),
     _cur_addr(start_address),
     _end_addr(end_address),
     _page_size(page_size),
-    _chunk_size(chunk_size) {
+    _chunk_size(chunk_size),
+    _chunk_alignment(chunk_alignment) {
 
   assert(chunk_size >= page_size,
          "Chunk size %zu is smaller than page size %zu",
          chunk_size, page_size);
+  assert(chunk_size >= chunk_alignment,
+         "Chunk size %zu is smaller than chunk alignment %zu",
+         chunk_size, chunk_alignment);
 }
 
 size_t PretouchTask::chunk_size() {
@@ -54,6 +59,12 @@ void PretouchTask::work(uint worker_id) {
   while (true) {
     char* cur_start = Atomic::load(&_cur_addr);
     char* cur_end = cur_start + MIN2(_chunk_size, pointer_delta(_end_addr, cur_start, 1));
+    // Align the end of the chunk, so an unaligned start address only makes
+    // the first chunk shorter, rather than making every chunk straddle pages.
+    char* aligned_end = align_down(cur_end, _chunk_alignment);
+    if (aligned_end > cur_start) {
+      cur_end = aligned_end;
+    }
     if (cur_start >= cur_end) {
       break;
     } else if (cur_start == Atomic::cmpxchg(&_cur_addr, cur_start, cur_end)) {
@@ -64,10 +75,16 @@ void PretouchTask::work(uint worker_id) {
 
 void PretouchTask::pretouch(const char* task_name, char* start_address, char* end_address,
                             size_t page_size, WorkerThreads* pretouch_workers) {
-  // Page-align the chunk size, so if start_address is also page-aligned (as
-  // is common) then there won't be any pages shared by multiple chunks.
-  size_t chunk_size = align_down_bounded(PretouchTask::chunk_size(), page_size);
-  PretouchTask task(task_name, start_address, end_address, page_size, chunk_size);
+  // Page-align the chunk size and the chunk boundaries, so there won't be any
+  // pages shared by multiple chunks.  With transparent huge pages the memory
+  // is touched using small pages, but may be backed by large pages, so align
+  // to the large page size to let each large page be populated at once.
+  size_t chunk_alignment = page_size;
+  if (UseTransparentHugePages) {
+    chunk_alignment = MAX2(chunk_alignment, os::large_page_size());
+  }
+  size_t chunk_size = align_down_bounded(PretouchTask::chunk_size(), chunk_alignment);
+  PretouchTask task(task_name, start_address, end_address, page_size, chunk_size, chunk_alignment);
   size_t total_bytes = pointer_delta(end_address, start_address, sizeof(char));
 
   if (total_bytes == 0) {
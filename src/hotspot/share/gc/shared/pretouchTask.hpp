@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,9 +32,13 @@ class PretouchTask : public WorkerTask {
   char* const _end_addr;
   size_t _page_size;
   size_t _chunk_size;
+  // Chunks end on a multiple of this alignment, so that no page of this size
+  // is touched by multiple workers.
+  size_t _chunk_alignment;
 
 public:
-  PretouchTask(const char* task_name, char* start_address, char* end_address, size_t page_size, size_t chunk_size);
+  PretouchTask(const char* task_name, char* start_address, char* end_address,
+               size_t page_size, size_t chunk_size, size_t chunk_alignment);
 
   virtual void work(uint worker_id);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -604,6 +604,21 @@ bool ReferenceProcessor::need_balance_queues(DiscoveredList refs_lists[]) {
         return true;            // Must balance despite configuration.
       }
     }
+    // A single list much longer than the others serializes the phase on
+    // one worker, so split it up even though configured not to balance.
+    if (ParallelRefProcBalancingSkewFactor > 0) {
+      size_t total_refs = 0;
+      size_t max_refs = 0;
+      for (uint i = 0; i < _num_queues; ++i) {
+        total_refs += refs_lists[i].length();
+        max_refs = MAX2(max_refs, refs_lists[i].length());
+      }
+      size_t const avg_refs = total_refs / _num_queues + 1;
+      if (max_refs > avg_refs * ParallelRefProcBalancingSkewFactor) {
+        log_debug(gc, ref)("Balancing skewed discovered lists: max %zu avg %zu", max_refs, avg_refs);
+        return true;
+      }
+    }
     return false;               // Safe to obey configuration and not balance.
   }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_batched,    // subset of successful steals taken in a batch after the first
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -68,6 +69,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_batched() { ++_stats[steal_batched]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -382,7 +384,10 @@ class GenericTaskQueue: public TaskQueueSuper<N, MT> {
   // Element array.
   E* _elems;
 
-  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_PADDING_SIZE, sizeof(E*));
+  // The NUMA node the owner last stole on, read by thieves for victim selection.
+  uint _numa_id;
+
+  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_PADDING_SIZE, sizeof(E*) + sizeof(uint));
   // Queue owner local variables. Not to be accessed by other threads.
 
   static const uint InvalidQueueId = uint(-1);
@@ -397,6 +402,9 @@ class GenericTaskQueue: public TaskQueueSuper<N, MT> {
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
+  void set_numa_id(uint id)                  { _numa_id = id; }
+  uint numa_id() const                       { return _numa_id; }
+
   void invalidate_last_stolen_queue_id()     {
     TASKQUEUE_STATS_ONLY(stats.record_bias_drop();)
     _last_stolen_queue_id = InvalidQueueId;
@@ -466,6 +474,10 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
   uint _n;
   T** _queues;
 
+  // Moves up to GCStealBatchSize - 1 further elements from the queue that
+  // an element has just been stolen from into queue_num.
+  void steal_batch(uint queue_num, uint victim);
+
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
   // as for the last pop_global() operation.
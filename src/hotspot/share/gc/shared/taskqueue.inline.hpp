@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,7 +33,10 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
+#include "utilities/checkedCast.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -99,6 +102,7 @@ inline void GenericTaskQueueSet<T, MT>::print_and_reset_taskqueue_stats(const ch
 template<class E, MemTag MT, unsigned int N>
 inline GenericTaskQueue<E, MT, N>::GenericTaskQueue() :
   _elems(MallocArrayAllocator<E>::allocate(N, MT)),
+  _numa_id(0),
   _last_stolen_queue_id(InvalidQueueId),
   _seed(17 /* random number */) {}
 
@@ -338,6 +342,19 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
     uint sz1 = queue(k1)->size();
     uint sz2 = queue(k2)->size();
 
+    if (UseNUMA && GCStealPreferLocalNUMANode && sz1 > 0 && sz2 > 0) {
+      // Count the tasks on the local node double when comparing, so that a
+      // remote victim is only preferred if it has much more work.
+      const uint numa_id = local_queue->numa_id();
+      const bool local1 = queue(k1)->numa_id() == numa_id;
+      const bool local2 = queue(k2)->numa_id() == numa_id;
+      if (local1 && !local2) {
+        sz1 = MIN2(sz1, UINT_MAX / 2) * 2;
+      } else if (local2 && !local1) {
+        sz2 = MIN2(sz2, UINT_MAX / 2) * 2;
+      }
+    }
+
     uint sel_k = 0;
     PopResult suc = PopResult::Empty;
 
@@ -353,6 +370,7 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
 
     if (suc == PopResult::Success) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      steal_batch(queue_num, sel_k);
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -363,6 +381,9 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
     uint k = (queue_num + 1) % 2;
     PopResult res = queue(k)->pop_global(t);
     TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res == PopResult::Success) {
+      steal_batch(queue_num, k);
+    }
     return res;
   } else {
     assert(_n == 1, "can't be zero.");
@@ -371,10 +392,41 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
   }
 }
 
+template<class T, MemTag MT>
+void GenericTaskQueueSet<T, MT>::steal_batch(uint queue_num, uint victim) {
+  if (GCStealBatchSize == 1) {
+    return;
+  }
+
+  T* const local_queue = queue(queue_num);
+  T* const victim_queue = queue(victim);
+  // Take at most half of the remaining elements, and do not fill the local
+  // queue beyond half, so that pushing stolen elements never fails. Every
+  // element is claimed by its own pop_global, since the owner of the victim
+  // may concurrently pop from the other end without synchronizing with
+  // thieves unless the victim is about to become empty.
+  uint const max_batch = MIN2(GCStealBatchSize - 1, victim_queue->size() / 2);
+  for (uint i = 0; i < max_batch && local_queue->size() < local_queue->max_elems() / 2; i++) {
+    E e;
+    PopResult res = victim_queue->pop_global(e);
+    TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res != PopResult::Success) {
+      return;
+    }
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_batched();)
+    bool pushed = local_queue->push(e);
+    assert(pushed, "local queue has room");
+  }
+}
+
 template<class T, MemTag MT>
 bool GenericTaskQueueSet<T, MT>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
+  if (UseNUMA && GCStealPreferLocalNUMANode) {
+    queue(queue_num)->set_numa_id(checked_cast<uint>(os::numa_get_group_id()));
+  }
+
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
     PopResult sr = steal_best_of_2(queue_num, t);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,6 +107,15 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+
+    if (TLABRateAwareResize && used > 0.5 * capacity) {
+      // A thread that did not need a single refill allocated at most its
+      // current TLAB worth of memory. Sample that, so that the expected
+      // allocation of idle threads decays instead of staying at the level
+      // of their last busy period.
+      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+      _allocation_fraction.sample(alloc_frac);
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -178,6 +187,21 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   _number_of_refills++;
   _allocated_size += new_size;
   print_stats("fill");
+
+  if (TLABRateAwareResize && ResizeTLAB && _number_of_refills > _target_refills) {
+    // This thread has already used up its expected refills for this GC
+    // interval, so it allocates at a higher rate than its history predicts.
+    // Grow the next TLAB right away instead of waiting for the next GC;
+    // the allocation path still caps it at what the heap can provide.
+    const size_t grown_size = align_object_size(MIN2(desired_size() * 2, max_size()));
+    if (grown_size > desired_size()) {
+      log_trace(gc, tlab)("TLAB burst resize: thread: " PTR_FORMAT " [id: %2d]"
+                          " refills %u  desired_size: %zu -> %zu",
+                          p2i(thread()), thread()->osthread()->thread_id(),
+                          _number_of_refills, desired_size(), grown_size);
+      set_desired_size(grown_size);
+    }
+  }
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
   initialize(start, top, start + new_size - alignment_reserve());
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,12 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  product(bool, TLABRateAwareResize, false, EXPERIMENTAL,                   \
+          "Grow the TLAB of a thread that already refilled more than the "  \
+          "target number of times since the last GC, and let threads "      \
+          "that did not refill decay their expected allocation. Needs "     \
+          "ResizeTLAB.")                                                    \
+                                                                            \
 
 // end of TLAB_FLAGS
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -56,9 +56,26 @@ void WorkerTaskDispatcher::coordinator_distribute_task(WorkerTask* task, uint nu
   _started = 0;
 }
 
+void WorkerTaskDispatcher::worker_wait_for_task() {
+  // Tasks of a pause are usually dispatched in quick succession. Spinning
+  // for a while avoids the wakeup latency of blocking between them.
+  if (GCWorkerSpinBeforeParkMicros > 0 && SafepointSynchronize::is_at_safepoint()) {
+    const jlong deadline = os::javaTimeNanos() + (jlong)GCWorkerSpinBeforeParkMicros * (NANOUNITS / MICROUNITS);
+    do {
+      for (uint i = 0; i < 64; i++) {
+        if (_start_semaphore.trywait()) {
+          return;
+        }
+        SpinPause();
+      }
+    } while (os::javaTimeNanos() < deadline);
+  }
+  _start_semaphore.wait();
+}
+
 void WorkerTaskDispatcher::worker_run_task() {
   // Wait for the coordinator to dispatch a task.
-  _start_semaphore.wait();
+  worker_wait_for_task();
 
   // Get and set worker id.
   const uint worker_id = Atomic::fetch_then_add(&_started, 1u);
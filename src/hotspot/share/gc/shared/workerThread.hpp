@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2002, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2002, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -66,6 +66,9 @@ class WorkerTaskDispatcher {
   // Semaphore used to notify the coordinator that all workers are done.
   Semaphore _end_semaphore;
 
+  // Waits for the coordinator to dispatch a task, optionally spinning first.
+  void worker_wait_for_task();
+
 public:
   WorkerTaskDispatcher();
 
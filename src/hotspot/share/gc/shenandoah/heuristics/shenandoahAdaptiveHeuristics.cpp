@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2018, 2019, Red Hat, Inc. All rights reserved.
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -65,7 +65,10 @@ ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics(ShenandoahSpaceInfo*
   _margin_of_error_sd(ShenandoahAdaptiveInitialConfidence),
   _spike_threshold_sd(ShenandoahAdaptiveInitialSpikeThreshold),
   _last_trigger(OTHER),
-  _available(Moving_Average_Samples, ShenandoahAdaptiveDecayFactor) { }
+  _available(Moving_Average_Samples, ShenandoahAdaptiveDecayFactor),
+  _used_at_cycle_start(0),
+  _mark_time_per_byte(Moving_Average_Samples, ShenandoahAdaptiveDecayFactor),
+  _non_mark_time(Moving_Average_Samples, ShenandoahAdaptiveDecayFactor) { }
 
 ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {}
 
@@ -130,10 +133,35 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
 void ShenandoahAdaptiveHeuristics::record_cycle_start() {
   ShenandoahHeuristics::record_cycle_start();
   _allocation_rate.allocation_counter_reset();
+  _used_at_cycle_start = _space_info->used();
+}
+
+void ShenandoahAdaptiveHeuristics::record_cycle_cost() {
+  const double cycle_time = elapsed_cycle_time();
+  const double mark_time = ShenandoahHeap::heap()->phase_timings()->cycle_phase_time(ShenandoahPhaseTimings::conc_mark);
+  if (_used_at_cycle_start == 0 || mark_time <= 0.0 || mark_time > cycle_time) {
+    // Nothing to learn from
+    return;
+  }
+
+  _mark_time_per_byte.add(mark_time / _used_at_cycle_start);
+  _non_mark_time.add(cycle_time - mark_time);
+}
+
+double ShenandoahAdaptiveHeuristics::predicted_cycle_time() const {
+  const double avg_cycle_time = _gc_cycle_time_history->davg() + (_margin_of_error_sd * _gc_cycle_time_history->dsd());
+  if (!ShenandoahAdaptivePredictCycleTime || _mark_time_per_byte.num() == 0) {
+    return avg_cycle_time;
+  }
+
+  const double mark_time_per_byte = _mark_time_per_byte.davg() + (_margin_of_error_sd * _mark_time_per_byte.dsd());
+  const double non_mark_time = _non_mark_time.davg() + (_margin_of_error_sd * _non_mark_time.dsd());
+  return mark_time_per_byte * _space_info->used() + non_mark_time;
 }
 
 void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
   ShenandoahHeuristics::record_success_concurrent();
+  record_cycle_cost();
 
   size_t available = _space_info->available();
 
@@ -282,7 +310,7 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
   allocation_headroom -= MIN2(allocation_headroom, spike_headroom);
   allocation_headroom -= MIN2(allocation_headroom, penalties);
 
-  double avg_cycle_time = _gc_cycle_time_history->davg() + (_margin_of_error_sd * _gc_cycle_time_history->dsd());
+  double avg_cycle_time = predicted_cycle_time();
   double avg_alloc_rate = _allocation_rate.upper_bound(_margin_of_error_sd);
 
   log_debug(gc)("average GC time: %.2f ms, allocation rate: %.0f %s/s",
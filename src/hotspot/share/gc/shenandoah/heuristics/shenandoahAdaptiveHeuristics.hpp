@@ -107,6 +107,8 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
     SPIKE, RATE, OTHER
   };
 
+  void record_cycle_cost();
+
   void adjust_last_trigger_parameters(double amount);
   void adjust_margin_of_error(double amount);
   void adjust_spike_threshold(double amount);
@@ -140,6 +142,20 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
   // source of feedback to adjust trigger parameters.
   TruncatedSeq _available;
 
+  // The used memory at the start of the current cycle, which bounds the
+  // amount of data concurrent marking has to trace.
+  size_t _used_at_cycle_start;
+
+  // Concurrent marking time scales with the amount of data to mark, while
+  // the remaining phases of a cycle are dominated by the collection set and
+  // the roots. The two are learned separately, such that the cycle time can be
+  // predicted for the amount of used memory at the time of the trigger.
+  TruncatedSeq _mark_time_per_byte;
+  TruncatedSeq _non_mark_time;
+
+  // The expected time to complete a cycle, including the margin of error.
+  double predicted_cycle_time() const;
+
   // A conservative minimum threshold of free space that we'll try to maintain when possible.
   // For example, we might trigger a concurrent gc if we are likely to drop below
   // this threshold, or we might consider this when dynamically resizing generations
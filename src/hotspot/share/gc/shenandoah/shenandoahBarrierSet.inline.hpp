@@ -70,7 +70,7 @@ inline oop ShenandoahBarrierSet::load_reference_barrier_mutator(oop obj, T* load
     assert(_heap->is_evacuation_in_progress(), "evac should be in progress");
     Thread* const t = Thread::current();
     ShenandoahEvacOOMScope scope(t);
-    fwd = _heap->evacuate_object(obj, t);
+    fwd = _heap->evacuate_object_mutator(obj, t);
   }
 
   if (load_addr != nullptr && fwd != obj) {
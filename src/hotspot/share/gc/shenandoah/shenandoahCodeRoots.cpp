@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2017, 2022, Red Hat, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -141,7 +141,9 @@ class ShenandoahNMethodUnlinkClosure : public NMethodClosure {
       return;
     }
 
-    {
+    // Nmethods are only disarmed concurrently, by the entry barrier after healing them.
+    // Do not contend with the entry barrier for the lock of an nmethod that is already healed.
+    if (_bs->is_armed(nm)) {
       ShenandoahReentrantLocker locker(nm_data->lock());
 
       // Heal oops and disarm
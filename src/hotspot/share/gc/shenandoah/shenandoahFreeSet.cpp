@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2016, 2021, Red Hat, Inc. All rights reserved.
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
  */
 
 #include "gc/shared/tlab_globals.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "gc/shenandoah/shenandoahAffiliation.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
@@ -36,6 +37,7 @@
 #include "gc/shenandoah/shenandoahYoungGeneration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
 
 static const char* partition_name(ShenandoahFreeSetPartitionId t) {
@@ -1395,53 +1397,133 @@ void ShenandoahFreeSet::clear_internal() {
   _partitions.set_bias_from_left_to_right(ShenandoahFreeSetPartitionId::OldCollector, false);
 }
 
-void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regions, size_t &old_cset_regions,
-                                                         size_t &first_old_region, size_t &last_old_region,
-                                                         size_t &old_region_count) {
-  clear_internal();
+ShenandoahFreeSet::AllocCapacitySummary::AllocCapacitySummary(size_t max_regions, size_t num_regions) :
+  _young_cset_regions(0),
+  _old_cset_regions(0),
+  _first_old_region(num_regions),
+  _last_old_region(0),
+  _old_region_count(0),
+  _mutator_leftmost(max_regions),
+  _mutator_rightmost(0),
+  _mutator_leftmost_empty(max_regions),
+  _mutator_rightmost_empty(0),
+  _mutator_regions(0),
+  _mutator_used(0),
+  _old_collector_leftmost(max_regions),
+  _old_collector_rightmost(0),
+  _old_collector_leftmost_empty(max_regions),
+  _old_collector_rightmost_empty(0),
+  _old_collector_regions(0),
+  _old_collector_used(0) {}
+
+void ShenandoahFreeSet::AllocCapacitySummary::merge(const AllocCapacitySummary& other) {
+  _young_cset_regions += other._young_cset_regions;
+  _old_cset_regions += other._old_cset_regions;
+  _first_old_region = MIN2(_first_old_region, other._first_old_region);
+  _last_old_region = MAX2(_last_old_region, other._last_old_region);
+  _old_region_count += other._old_region_count;
+
+  _mutator_leftmost = MIN2(_mutator_leftmost, other._mutator_leftmost);
+  _mutator_rightmost = MAX2(_mutator_rightmost, other._mutator_rightmost);
+  _mutator_leftmost_empty = MIN2(_mutator_leftmost_empty, other._mutator_leftmost_empty);
+  _mutator_rightmost_empty = MAX2(_mutator_rightmost_empty, other._mutator_rightmost_empty);
+  _mutator_regions += other._mutator_regions;
+  _mutator_used += other._mutator_used;
+
+  _old_collector_leftmost = MIN2(_old_collector_leftmost, other._old_collector_leftmost);
+  _old_collector_rightmost = MAX2(_old_collector_rightmost, other._old_collector_rightmost);
+  _old_collector_leftmost_empty = MIN2(_old_collector_leftmost_empty, other._old_collector_leftmost_empty);
+  _old_collector_rightmost_empty = MAX2(_old_collector_rightmost_empty, other._old_collector_rightmost_empty);
+  _old_collector_regions += other._old_collector_regions;
+  _old_collector_used += other._old_collector_used;
+}
+
+class ShenandoahFindRegionsWithAllocCapacityTask : public WorkerTask {
+private:
+  typedef ShenandoahFreeSet::AllocCapacitySummary Summary;
 
-  first_old_region = _heap->num_regions();
-  last_old_region = 0;
-  old_region_count = 0;
-  old_cset_regions = 0;
-  young_cset_regions = 0;
+  ShenandoahFreeSet* const _free_set;
+  const size_t _num_regions;
+  const uint _num_summaries;
+  Summary* const _summaries;
 
-  size_t region_size_bytes = _partitions.region_size_bytes();
-  size_t max_regions = _partitions.max_regions();
+  shenandoah_padding(0);
+  volatile size_t _claimed;
+  shenandoah_padding(1);
+
+public:
+  ShenandoahFindRegionsWithAllocCapacityTask(ShenandoahFreeSet* free_set, size_t max_regions, size_t num_regions, uint num_workers) :
+    WorkerTask("Shenandoah Find Regions With Alloc Capacity"),
+    _free_set(free_set),
+    _num_regions(num_regions),
+    _num_summaries(num_workers),
+    _summaries(NEW_C_HEAP_ARRAY(Summary, num_workers, mtGC)),
+    _claimed(0) {
+    for (uint i = 0; i < _num_summaries; i++) {
+      ::new (&_summaries[i]) Summary(max_regions, num_regions);
+    }
+  }
 
-  size_t mutator_leftmost = max_regions;
-  size_t mutator_rightmost = 0;
-  size_t mutator_leftmost_empty = max_regions;
-  size_t mutator_rightmost_empty = 0;
-  size_t mutator_regions = 0;
-  size_t mutator_used = 0;
+  ~ShenandoahFindRegionsWithAllocCapacityTask() {
+    FREE_C_HEAP_ARRAY(Summary, _summaries);
+  }
 
-  size_t old_collector_leftmost = max_regions;
-  size_t old_collector_rightmost = 0;
-  size_t old_collector_leftmost_empty = max_regions;
-  size_t old_collector_rightmost_empty = 0;
-  size_t old_collector_regions = 0;
-  size_t old_collector_used = 0;
+  void work(uint worker_id) override {
+    assert(worker_id < _num_summaries, "Invalid worker id: %u", worker_id);
+    for (;;) {
+      const size_t beg = Atomic::fetch_then_add(&_claimed, ShenandoahFreeSet::ParallelRebuildStride, memory_order_relaxed);
+      if (beg >= _num_regions) {
+        return;
+      }
+      const size_t end = MIN2(beg + ShenandoahFreeSet::ParallelRebuildStride, _num_regions);
+      _free_set->find_regions_with_alloc_capacity(beg, end, _summaries[worker_id]);
+    }
+  }
 
-  size_t num_regions = _heap->num_regions();
-  for (size_t idx = 0; idx < num_regions; idx++) {
+  void merge_into(Summary& summary) const {
+    for (uint i = 0; i < _num_summaries; i++) {
+      summary.merge(_summaries[i]);
+    }
+  }
+};
+
+bool ShenandoahFreeSet::should_find_regions_with_alloc_capacity_in_parallel() const {
+  if (_heap->num_regions() < 4 * ParallelRebuildStride) {
+    // Not worth waking up the workers
+    return false;
+  }
+
+  WorkerThreads* const workers = _heap->workers();
+  if (workers == nullptr || workers->active_workers() < 2) {
+    return false;
+  }
+
+  // Only threads that drive the collection may run worker tasks
+  Thread* const current = Thread::current();
+  return current->is_VM_thread() || current->is_ConcurrentGC_thread();
+}
+
+void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t beg, size_t end, AllocCapacitySummary& summary) {
+  size_t region_size_bytes = _partitions.region_size_bytes();
+
+  for (size_t idx = beg; idx < end; idx++) {
     ShenandoahHeapRegion* region = _heap->get_region(idx);
     if (region->is_trash()) {
       // Trashed regions represent regions that had been in the collection partition but have not yet been "cleaned up".
       // The cset regions are not "trashed" until we have finished update refs.
       if (region->is_old()) {
-        old_cset_regions++;
+        summary._old_cset_regions++;
       } else {
         assert(region->is_young(), "Trashed region should be old or young");
-        young_cset_regions++;
+        summary._young_cset_regions++;
       }
     } else if (region->is_old()) {
       // count both humongous and regular regions, but don't count trash (cset) regions.
-      old_region_count++;
-      if (first_old_region > idx) {
-        first_old_region = idx;
+      summary._old_region_count++;
+      if (summary._first_old_region > idx) {
+        summary._first_old_region = idx;
       }
-      last_old_region = idx;
+      summary._last_old_region = idx;
     }
     if (region->is_alloc_allowed() || region->is_trash()) {
       assert(!region->is_cset(), "Shouldn't be adding cset regions to the free set");
@@ -1452,45 +1534,85 @@ void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regi
         if (region->is_trash() || !region->is_old()) {
           // Both young and old collected regions (trashed) are placed into the Mutator set
           _partitions.raw_assign_membership(idx, ShenandoahFreeSetPartitionId::Mutator);
-          if (idx < mutator_leftmost) {
-            mutator_leftmost = idx;
+          if (idx < summary._mutator_leftmost) {
+            summary._mutator_leftmost = idx;
           }
-          if (idx > mutator_rightmost) {
-            mutator_rightmost = idx;
+          if (idx > summary._mutator_rightmost) {
+            summary._mutator_rightmost = idx;
           }
           if (ac == region_size_bytes) {
-            if (idx < mutator_leftmost_empty) {
-              mutator_leftmost_empty = idx;
+            if (idx < summary._mutator_leftmost_empty) {
+              summary._mutator_leftmost_empty = idx;
             }
-            if (idx > mutator_rightmost_empty) {
-              mutator_rightmost_empty = idx;
+            if (idx > summary._mutator_rightmost_empty) {
+              summary._mutator_rightmost_empty = idx;
             }
           }
-          mutator_regions++;
-          mutator_used += (region_size_bytes - ac);
+          summary._mutator_regions++;
+          summary._mutator_used += (region_size_bytes - ac);
         } else {
           // !region->is_trash() && region is_old()
           _partitions.raw_assign_membership(idx, ShenandoahFreeSetPartitionId::OldCollector);
-          if (idx < old_collector_leftmost) {
-            old_collector_leftmost = idx;
+          if (idx < summary._old_collector_leftmost) {
+            summary._old_collector_leftmost = idx;
           }
-          if (idx > old_collector_rightmost) {
-            old_collector_rightmost = idx;
+          if (idx > summary._old_collector_rightmost) {
+            summary._old_collector_rightmost = idx;
           }
           if (ac == region_size_bytes) {
-            if (idx < old_collector_leftmost_empty) {
-              old_collector_leftmost_empty = idx;
+            if (idx < summary._old_collector_leftmost_empty) {
+              summary._old_collector_leftmost_empty = idx;
             }
-            if (idx > old_collector_rightmost_empty) {
-              old_collector_rightmost_empty = idx;
+            if (idx > summary._old_collector_rightmost_empty) {
+              summary._old_collector_rightmost_empty = idx;
             }
           }
-          old_collector_regions++;
-          old_collector_used += (region_size_bytes - ac);
+          summary._old_collector_regions++;
+          summary._old_collector_used += (region_size_bytes - ac);
         }
       }
     }
   }
+}
+
+void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regions, size_t &old_cset_regions,
+                                                         size_t &first_old_region, size_t &last_old_region,
+                                                         size_t &old_region_count) {
+  clear_internal();
+
+  size_t max_regions = _partitions.max_regions();
+  size_t num_regions = _heap->num_regions();
+
+  AllocCapacitySummary summary(max_regions, num_regions);
+  if (should_find_regions_with_alloc_capacity_in_parallel()) {
+    WorkerThreads* const workers = _heap->workers();
+    ShenandoahFindRegionsWithAllocCapacityTask task(this, max_regions, num_regions, workers->active_workers());
+    workers->run_task(&task);
+    task.merge_into(summary);
+  } else {
+    find_regions_with_alloc_capacity(0, num_regions, summary);
+  }
+
+  young_cset_regions = summary._young_cset_regions;
+  old_cset_regions = summary._old_cset_regions;
+  first_old_region = summary._first_old_region;
+  last_old_region = summary._last_old_region;
+  old_region_count = summary._old_region_count;
+
+  size_t mutator_leftmost = summary._mutator_leftmost;
+  size_t mutator_rightmost = summary._mutator_rightmost;
+  size_t mutator_leftmost_empty = summary._mutator_leftmost_empty;
+  size_t mutator_rightmost_empty = summary._mutator_rightmost_empty;
+  size_t mutator_regions = summary._mutator_regions;
+  size_t mutator_used = summary._mutator_used;
+
+  size_t old_collector_leftmost = summary._old_collector_leftmost;
+  size_t old_collector_rightmost = summary._old_collector_rightmost;
+  size_t old_collector_leftmost_empty = summary._old_collector_leftmost_empty;
+  size_t old_collector_rightmost_empty = summary._old_collector_rightmost_empty;
+  size_t old_collector_regions = summary._old_collector_regions;
+  size_t old_collector_used = summary._old_collector_used;
+
   log_debug(gc, free)("  At end of prep_to_rebuild, mutator_leftmost: %zu"
                       ", mutator_rightmost: %zu"
                       ", mutator_leftmost_empty: %zu"
@@ -312,10 +312,46 @@ class ShenandoahRegionPartitions {
 //     during the next GC pass.
 
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
+  friend class ShenandoahFindRegionsWithAllocCapacityTask;
 private:
   ShenandoahHeap* const _heap;
   ShenandoahRegionPartitions _partitions;
 
+  // Regions with allocation capacity found in a range of regions, see find_regions_with_alloc_capacity().
+  struct AllocCapacitySummary {
+    size_t _young_cset_regions;
+    size_t _old_cset_regions;
+    size_t _first_old_region;
+    size_t _last_old_region;
+    size_t _old_region_count;
+
+    size_t _mutator_leftmost;
+    size_t _mutator_rightmost;
+    size_t _mutator_leftmost_empty;
+    size_t _mutator_rightmost_empty;
+    size_t _mutator_regions;
+    size_t _mutator_used;
+
+    size_t _old_collector_leftmost;
+    size_t _old_collector_rightmost;
+    size_t _old_collector_leftmost_empty;
+    size_t _old_collector_rightmost_empty;
+    size_t _old_collector_regions;
+    size_t _old_collector_used;
+
+    AllocCapacitySummary(size_t max_regions, size_t num_regions);
+
+    void merge(const AllocCapacitySummary& other);
+  };
+
+  // Regions are assigned to partitions in parallel in stripes of this many regions. Stripes
+  // are word aligned in the partition bitmaps, so that workers never update the same word.
+  static const size_t ParallelRebuildStride = 1024;
+  STATIC_ASSERT(ParallelRebuildStride % BitsPerWord == 0);
+
+  bool should_find_regions_with_alloc_capacity_in_parallel() const;
+  void find_regions_with_alloc_capacity(size_t beg, size_t end, AllocCapacitySummary& summary);
+
   HeapWord* allocate_aligned_plab(size_t size, ShenandoahAllocRequest& req, ShenandoahHeapRegion* r);
 
   // Return the address of memory allocated, setting in_new_region to true iff the allocation is taken
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2013, 2022, Red Hat, Inc. All rights reserved.
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
@@ -941,6 +941,9 @@ HeapWord* ShenandoahHeap::allocate_from_gclab_slow(Thread* thread, size_t size)
 HeapWord* ShenandoahHeap::allocate_new_tlab(size_t min_size,
                                             size_t requested_size,
                                             size_t* actual_size) {
+  if (ShenandoahPacing && ShenandoahPacingTrickle) {
+    requested_size = pacer()->paced_tlab_size(min_size, requested_size);
+  }
   ShenandoahAllocRequest req = ShenandoahAllocRequest::for_tlab(min_size, requested_size);
   HeapWord* res = allocate_memory(req);
   if (res != nullptr) {
@@ -1354,6 +1357,31 @@ oop ShenandoahHeap::evacuate_object(oop p, Thread* thread) {
   return try_evacuate_object(p, thread, r, target_gen);
 }
 
+oop ShenandoahHeap::evacuate_object_mutator(oop p, Thread* thread) {
+  if (!ShenandoahMutatorEvacRegionClaim) {
+    return evacuate_object(p, thread);
+  }
+
+  ShenandoahHeapRegion* r = heap_region_containing(p);
+  for (uint spins = 0; !r->try_claim_mutator_evac(); spins++) {
+    // Another mutator evacuates from this region, most likely the same hot object.
+    // Prefer its copy over making a copy that would be thrown away.
+    const oop fwd = ShenandoahForwarding::get_forwardee_mutator(p);
+    if (fwd != p) {
+      return fwd;
+    }
+    if (spins >= MutatorEvacClaimSpins) {
+      // Do not wait for long, race for the copy instead.
+      return evacuate_object(p, thread);
+    }
+    SpinPause();
+  }
+
+  const oop result = evacuate_object(p, thread);
+  r->release_mutator_evac();
+  return result;
+}
+
 oop ShenandoahHeap::try_evacuate_object(oop p, Thread* thread, ShenandoahHeapRegion* from_region,
                                                ShenandoahAffiliation target_gen) {
   assert(target_gen == YOUNG_GENERATION, "Only expect evacuations to young in this mode");
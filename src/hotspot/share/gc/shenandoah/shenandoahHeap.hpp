@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2013, 2021, Red Hat, Inc. All rights reserved.
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
@@ -788,6 +788,9 @@ class ShenandoahHeap : public CollectedHeap {
 
   oop try_evacuate_object(oop src, Thread* thread, ShenandoahHeapRegion* from_region, ShenandoahAffiliation target_gen);
 
+  // How many times a mutator spins for a claimed region before evacuating anyway.
+  static const uint MutatorEvacClaimSpins = 128;
+
 public:
   static address in_cset_fast_test_addr();
 
@@ -803,6 +806,11 @@ class ShenandoahHeap : public CollectedHeap {
   // by this thread, or by some other thread.
   virtual oop evacuate_object(oop src, Thread* thread);
 
+  // Evacuates object src from the mutator load reference barrier slow path. With
+  // ShenandoahMutatorEvacRegionClaim, only one mutator at a time evacuates from the
+  // region of src, and others briefly wait for the forwardee before racing for a copy.
+  oop evacuate_object_mutator(oop src, Thread* thread);
+
   // Call before/after evacuation.
   inline void enter_evacuation(Thread* t);
   inline void leave_evacuation(Thread* t);
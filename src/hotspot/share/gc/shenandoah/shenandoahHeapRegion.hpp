@@ -265,6 +265,7 @@ class ShenandoahHeapRegion {
   CENSUS_NOISE(uint _youth;)   // tracks epochs of retrograde ageing (rejuvenation)
 
   ShenandoahSharedFlag _recycling; // Used to indicate that the region is being recycled; see try_recycle*().
+  ShenandoahSharedFlag _mutator_evac_claim; // Used to indicate that a mutator evacuates from this region.
 
   bool _needs_bitmap_reset;
 
@@ -387,6 +388,16 @@ class ShenandoahHeapRegion {
 
   void try_recycle();
 
+  // Mutators claim the region while evacuating an object from it, so that
+  // other mutators can wait for the (likely hot) object instead of copying it too.
+  inline bool try_claim_mutator_evac() {
+    return _mutator_evac_claim.try_set();
+  }
+
+  inline void release_mutator_evac() {
+    _mutator_evac_claim.unset();
+  }
+
   inline void begin_preemptible_coalesce_and_fill() {
     _coalesce_and_fill_boundary = _bottom;
   }
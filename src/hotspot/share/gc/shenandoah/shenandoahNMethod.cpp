@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2019, 2022, Red Hat, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -29,6 +29,7 @@
 #include "gc/shenandoah/shenandoahNMethod.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/continuation.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "runtime/safepointVerifiers.hpp"
 
 ShenandoahNMethod::ShenandoahNMethod(nmethod* nm, GrowableArray<oop*>& oops, bool non_immediate_oops) :
@@ -427,6 +428,17 @@ ShenandoahNMethodTableSnapshot::~ShenandoahNMethodTableSnapshot() {
   _list->release();
 }
 
+// Prefetch what the closure touches next: the nmethod of the next entry, and the
+// entry after that, whose nmethod is then prefetched in the next iteration.
+static inline void prefetch_nmethods(ShenandoahNMethod** list, size_t idx, size_t end) {
+  if (idx + 1 < end) {
+    Prefetch::read(list[idx + 1]->nm(), 0);
+  }
+  if (idx + 2 < end) {
+    Prefetch::read(list[idx + 2], 0);
+  }
+}
+
 void ShenandoahNMethodTableSnapshot::parallel_nmethods_do(NMethodClosure *f) {
   size_t stride = 256; // educated guess
 
@@ -440,6 +452,7 @@ void ShenandoahNMethodTableSnapshot::parallel_nmethods_do(NMethodClosure *f) {
     if (start >= max) break;
 
     for (size_t idx = start; idx < end; idx++) {
+      prefetch_nmethods(list, idx, end);
       ShenandoahNMethod* nmr = list[idx];
       assert(nmr != nullptr, "Sanity");
       if (nmr->is_unregistered()) {
@@ -464,6 +477,7 @@ void ShenandoahNMethodTableSnapshot::concurrent_nmethods_do(NMethodClosure* cl)
     if (start >= max) break;
 
     for (size_t idx = start; idx < end; idx++) {
+      prefetch_nmethods(list, idx, end);
       ShenandoahNMethod* data = list[idx];
       assert(data != nullptr, "Should not be null");
       if (!data->is_unregistered()) {
@@ -1,6 +1,6 @@
 /*
  * Copyright (c) 2018, 2019, Red Hat, Inc. All rights reserved.
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,8 +26,10 @@
 
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
+#include "gc/shenandoah/shenandoahHeapRegion.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -250,6 +252,11 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // This can happen during VM init when main thread is still not an
   // active Java thread.
   JavaThread* current = JavaThread::current();
+  if (ShenandoahPacingTrickle) {
+    trickle_for_alloc(current, words);
+    return;
+  }
+
   if (current->is_attaching_via_jni() ||
       !current->is_active_Java_thread()) {
     claim_for_alloc<true>(words);
@@ -273,6 +280,43 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   ShenandoahThreadLocalData::add_paced_time(current, (double)(os::javaTimeNanos() - start_time) / NANOSECS_PER_SEC);
 }
 
+void ShenandoahPacer::trickle_for_alloc(JavaThread* current, size_t words) {
+  // Allocate anyway, which may mean we outpace GC. Make this thread refill
+  // its TLAB more often, so that it comes back to the pacer sooner.
+  claim_for_alloc<true>(words);
+
+  size_t tlab_size = ShenandoahThreadLocalData::paced_tlab_size(current);
+  if (tlab_size == 0) {
+    tlab_size = ShenandoahHeapRegion::max_tlab_size_words();
+  }
+  ShenandoahThreadLocalData::set_paced_tlab_size(current, MAX2<size_t>(1, tlab_size / 2));
+}
+
+size_t ShenandoahPacer::paced_tlab_size(size_t min_size, size_t requested_size) {
+  assert(ShenandoahPacing && ShenandoahPacingTrickle, "Only be here when trickle pacing is enabled");
+
+  Thread* current = Thread::current();
+  size_t tlab_size = ShenandoahThreadLocalData::paced_tlab_size(current);
+  if (tlab_size == 0) {
+    // Not throttled
+    return requested_size;
+  }
+
+  if (Atomic::load(&_budget) >= (intptr_t)(tlab_size * Atomic::load(&_tax_rate))) {
+    // GC progress covers allocations again, relax the limit
+    tlab_size *= 2;
+    if (tlab_size >= ShenandoahHeapRegion::max_tlab_size_words()) {
+      tlab_size = 0;
+    }
+    ShenandoahThreadLocalData::set_paced_tlab_size(current, tlab_size);
+    if (tlab_size == 0) {
+      return requested_size;
+    }
+  }
+
+  return MAX2(min_size, MIN2(requested_size, tlab_size));
+}
+
 void ShenandoahPacer::wait(size_t time_ms) {
   // Perform timed wait. It works like like sleep(), except without modifying
   // the thread interruptible status. MonitorLocker also checks for safepoints.
@@ -31,6 +31,7 @@
 #include "memory/allocation.hpp"
 #include "runtime/task.hpp"
 
+class JavaThread;
 class ShenandoahHeap;
 class ShenandoahPacer;
 
@@ -56,6 +57,10 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ *
+ * With ShenandoahPacingTrickle, allocating threads never stall. Instead, each thread
+ * keeps its own TLAB size limit, which shrinks when the thread allocates beyond the
+ * available credit, and grows back when GC progress covers its allocations again.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -111,6 +116,7 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   bool claim_for_alloc(size_t words);
 
   void pace_for_alloc(size_t words);
+  size_t paced_tlab_size(size_t min_size, size_t requested_size);
   void unpace_for_alloc(intptr_t epoch, size_t words);
 
   void notify_waiters();
@@ -130,6 +136,7 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   size_t update_and_get_progress_history();
 
   void wait(size_t time_ms);
+  void trickle_for_alloc(JavaThread* current, size_t words);
 };
 
 #endif // SHARE_GC_SHENANDOAH_SHENANDOAHPACER_HPP
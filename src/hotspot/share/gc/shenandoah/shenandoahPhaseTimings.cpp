@@ -235,6 +235,11 @@ void ShenandoahPhaseTimings::flush_cycle_to_global() {
   OrderAccess::fence();
 }
 
+double ShenandoahPhaseTimings::cycle_phase_time(Phase phase) const {
+  const double cycle_data = _cycle_data[phase];
+  return (cycle_data == uninitialized()) ? 0.0 : cycle_data;
+}
+
 void ShenandoahPhaseTimings::print_cycle_on(outputStream* out) const {
   out->cr();
   out->print_cr("All times are wall-clock times, except per-root-class counters, that are sum over");
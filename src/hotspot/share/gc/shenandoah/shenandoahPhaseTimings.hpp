@@ -254,6 +254,9 @@ class ShenandoahPhaseTimings : public CHeapObj<mtGC> {
   void flush_par_workers_to_cycle();
   void flush_cycle_to_global();
 
+  // Time recorded for the phase in the current cycle, zero if not recorded.
+  double cycle_phase_time(Phase phase) const;
+
   static const char* phase_name(Phase phase) {
     assert(phase >= 0 && phase < _num_phases, "Out of bound");
     return _phase_names[phase];
@@ -1,6 +1,6 @@
 /*
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -306,6 +306,21 @@ bool ShenandoahScanRemembered::is_write_card_dirty(size_t card_index) {
   return _rs->is_write_card_dirty(card_index);
 }
 
+size_t ShenandoahScanRemembered::count_dirty_cards(HeapWord* start, HeapWord* end) {
+  if (start >= end) {
+    return 0;
+  }
+
+  const size_t end_card_index = _rs->card_index_for_addr(end - 1) + 1;
+  size_t dirty_cards = 0;
+  for (size_t i = _rs->card_index_for_addr(start); i < end_card_index; i++) {
+    if (_rs->is_card_dirty(i)) {
+      dirty_cards++;
+    }
+  }
+  return dirty_cards;
+}
+
 bool ShenandoahScanRemembered::is_card_dirty(HeapWord* p) {
   return _rs->is_card_dirty(p);
 }
@@ -697,6 +712,18 @@ void ShenandoahScanRememberedTask::do_work(uint worker_id) {
       if (end_of_range > region->top()) {
         end_of_range = region->top();
       }
+
+      // Leave the second half of chunks with many dirty cards to other workers,
+      // so that a few expensive chunks do not delay the end of the scan.
+      HeapWord* const start_of_range = region->bottom() + assignment._chunk_offset;
+      while (start_of_range < end_of_range &&
+             scanner->count_dirty_cards(start_of_range, end_of_range) * SplitDirtyCardsDivisor >=
+               pointer_delta(end_of_range, start_of_range) / CardTable::card_size_in_words() &&
+             _work_list->split(&assignment)) {
+        clusters = assignment._chunk_size / cluster_size;
+        end_of_range = MIN2(end_of_range, region->bottom() + assignment._chunk_offset + assignment._chunk_size);
+      }
+
       scanner->process_region_slice(region, assignment._chunk_offset, clusters, end_of_range, &cl, false, worker_id);
     }
 #ifdef ENABLE_REMEMBERED_SET_CANCELLATION
@@ -860,7 +887,9 @@ ShenandoahRegionChunkIterator::ShenandoahRegionChunkIterator(ShenandoahHeap* hea
     _first_group_chunk_size_b4_rebalance(calc_first_group_chunk_size_b4_rebalance()),
     _num_groups(calc_num_groups()),
     _total_chunks(calc_total_chunks()),
-    _index(0)
+    _index(0),
+    _split_reserved(0),
+    _split_claimed(0)
 {
 #ifdef ASSERT
   size_t expected_chunk_size_words = _clusters_in_smallest_chunk * CardTable::card_size_in_words() * ShenandoahCardCluster::CardsPerCluster;
@@ -922,10 +951,19 @@ ShenandoahRegionChunkIterator::ShenandoahRegionChunkIterator(ShenandoahHeap* hea
     _group_entries[i] = _group_entries[i-1];
     _group_chunk_size[i] = 0;
   }
+
+  for (size_t i = 0; i < _maximum_split_chunks; i++) {
+    _split_ready[i] = false;
+  }
 }
 
 void ShenandoahRegionChunkIterator::reset() {
   _index = 0;
+  _split_reserved = 0;
+  _split_claimed = 0;
+  for (size_t i = 0; i < _maximum_split_chunks; i++) {
+    _split_ready[i] = false;
+  }
 }
 
 ShenandoahReconstructRememberedSetTask::ShenandoahReconstructRememberedSetTask(ShenandoahRegionIterator* regions)
@@ -758,6 +758,9 @@ class ShenandoahScanRemembered: public CHeapObj<mtGC> {
   bool is_write_card_dirty(size_t card_index);
   bool is_card_dirty(HeapWord* p);
   bool is_write_card_dirty(HeapWord* p);
+
+  // Number of dirty cards in the read table spanning [start, end)
+  size_t count_dirty_cards(HeapWord* start, HeapWord* end);
   void mark_card_as_dirty(HeapWord* p);
   void mark_range_as_dirty(HeapWord* p, size_t num_heap_words);
   void mark_range_as_clean(HeapWord* p, size_t num_heap_words);
@@ -953,6 +956,20 @@ class ShenandoahRegionChunkIterator : public StackObj {
   volatile size_t _index;
   shenandoah_padding(1);
 
+  // Chunks split off by workers from the chunks they have claimed, which other
+  // workers claim before the remaining chunks above. This balances the work when
+  // a few chunks, e.g. in old regions with many dirty cards, are much more
+  // expensive to process than the others.
+  static const size_t _maximum_split_chunks = 256;
+  volatile size_t _split_reserved;
+  shenandoah_padding(2);
+  volatile size_t _split_claimed;
+  shenandoah_padding(3);
+  ShenandoahRegionChunk _split_chunks[_maximum_split_chunks];
+  volatile bool _split_ready[_maximum_split_chunks];
+
+  inline bool claim_split_chunk(struct ShenandoahRegionChunk* assignment);
+
   size_t _region_index[_maximum_groups];           // The region index for the first region spanned by this group
   size_t _group_offset[_maximum_groups];           // The offset at which group begins within first region spanned by this group
   size_t _group_chunk_size[_maximum_groups];       // The size of each chunk within this group
@@ -984,6 +1001,11 @@ class ShenandoahRegionChunkIterator : public StackObj {
   // Otherwise, returns false.  This is multi-thread-safe.
   inline bool next(struct ShenandoahRegionChunk* assignment);
 
+  // Splits the second half off the assignment, for other workers to claim through next().
+  // Returns false if the assignment is already of the smallest chunk size or if no more
+  // chunks can be split off. This is multi-thread-safe.
+  inline bool split(struct ShenandoahRegionChunk* assignment);
+
   // This is *not* MT safe. However, in the absence of multithreaded access, it
   // can be used to determine if there is more work to do.
   inline bool has_next() const;
@@ -992,6 +1014,9 @@ class ShenandoahRegionChunkIterator : public StackObj {
 
 class ShenandoahScanRememberedTask : public WorkerTask {
  private:
+  // Chunks where at least one in this many cards is dirty are split
+  static const size_t SplitDirtyCardsDivisor = 4;
+
   ShenandoahObjToScanQueueSet* _queue_set;
   ShenandoahObjToScanQueueSet* _old_queue_set;
   ShenandoahReferenceProcessor* _rp;
@@ -1,6 +1,6 @@
 /*
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,8 @@
 #include "memory/iterator.hpp"
 #include "oops/objArrayOop.hpp"
 #include "oops/oop.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 
 // Process all objects starting within count clusters beginning with first_cluster and for which the start address is
 // less than end_of_range.  For any non-array object whose header lies on a dirty card, scan the entire object,
@@ -362,10 +364,57 @@ ShenandoahScanRemembered::process_region_slice(ShenandoahHeapRegion *region, siz
 }
 
 inline bool ShenandoahRegionChunkIterator::has_next() const {
-  return _index < _total_chunks;
+  return _index < _total_chunks || _split_claimed < MIN2(_split_reserved, _maximum_split_chunks);
+}
+
+inline bool ShenandoahRegionChunkIterator::claim_split_chunk(struct ShenandoahRegionChunk* assignment) {
+  size_t claimed = Atomic::load(&_split_claimed);
+  while (claimed < MIN2(Atomic::load(&_split_reserved), _maximum_split_chunks)) {
+    const size_t prev = Atomic::cmpxchg(&_split_claimed, claimed, claimed + 1, memory_order_relaxed);
+    if (prev == claimed) {
+      // Wait for the splitting worker to publish the chunk
+      while (!Atomic::load_acquire(&_split_ready[claimed])) {
+        SpinPause();
+      }
+      *assignment = _split_chunks[claimed];
+      return true;
+    }
+    claimed = prev;
+  }
+  return false;
+}
+
+inline bool ShenandoahRegionChunkIterator::split(struct ShenandoahRegionChunk* assignment) {
+  if (assignment->_chunk_size < 2 * smallest_chunk_size_words()) {
+    return false;
+  }
+
+  if (Atomic::load(&_split_reserved) >= _maximum_split_chunks) {
+    return false;
+  }
+
+  const size_t index = Atomic::fetch_then_add(&_split_reserved, (size_t) 1, memory_order_relaxed);
+  if (index >= _maximum_split_chunks) {
+    return false;
+  }
+
+  // Chunk sizes are smallest_chunk_size_words() times a power of two, so both halves
+  // remain aligned on cluster boundaries.
+  const size_t half = assignment->_chunk_size / 2;
+  _split_chunks[index]._r = assignment->_r;
+  _split_chunks[index]._chunk_offset = assignment->_chunk_offset + half;
+  _split_chunks[index]._chunk_size = half;
+  Atomic::release_store(&_split_ready[index], true);
+
+  assignment->_chunk_size = half;
+  return true;
 }
 
 inline bool ShenandoahRegionChunkIterator::next(struct ShenandoahRegionChunk *assignment) {
+  if (claim_split_chunk(assignment)) {
+    return true;
+  }
+
   if (_index >= _total_chunks) {
     return false;
   }
@@ -37,26 +37,19 @@ inline uintx ShenandoahSimpleBitMap::tail_mask(uintx bit_number) {
 inline idx_t ShenandoahSimpleBitMap::find_first_set_bit(idx_t beg, idx_t end) const {
   assert((beg >= 0) && (beg < _num_bits), "precondition");
   assert((end > beg) && (end <= _num_bits), "precondition");
-  do {
-    size_t array_idx = beg >> LogBitsPerWord;
-    uintx bit_number = beg & (BitsPerWord - 1);
-    uintx element_bits = _bitmap[array_idx];
-    if (bit_number > 0) {
-      uintx mask_out = tail_mask(bit_number);
-      element_bits &= ~mask_out;
+  size_t array_idx = beg >> LogBitsPerWord;
+  const size_t last_array_idx = (end - 1) >> LogBitsPerWord;
+  uintx bit_number = beg & (BitsPerWord - 1);
+  uintx element_bits = _bitmap[array_idx] & ~tail_mask(bit_number);
+  // Skip over whole words without set bits
+  while (element_bits == 0) {
+    if (array_idx == last_array_idx) {
+      return end;
     }
-    if (element_bits) {
-      // The next set bit is here.  Find first set bit >= bit_number;
-      uintx aligned = element_bits >> bit_number;
-      uintx first_set_bit = count_trailing_zeros<uintx>(aligned);
-      idx_t candidate_result = (array_idx * BitsPerWord) + bit_number + first_set_bit;
-      return (candidate_result < end)? candidate_result: end;
-    } else {
-      // Next bit is not here.  Try the next array element
-      beg += BitsPerWord - bit_number;
-    }
-  } while (beg < end);
-  return end;
+    element_bits = _bitmap[++array_idx];
+  }
+  idx_t candidate_result = (array_idx * BitsPerWord) + count_trailing_zeros<uintx>(element_bits);
+  return (candidate_result < end)? candidate_result: end;
 }
 
 inline idx_t ShenandoahSimpleBitMap::find_first_set_bit(idx_t beg) const {
@@ -67,26 +60,19 @@ inline idx_t ShenandoahSimpleBitMap::find_first_set_bit(idx_t beg) const {
 inline idx_t ShenandoahSimpleBitMap::find_last_set_bit(idx_t beg, idx_t end) const {
   assert((end >= 0) && (end < _num_bits), "precondition");
   assert((beg >= -1) && (beg < end), "precondition");
-  do {
-    idx_t array_idx = end >> LogBitsPerWord;
-    uint8_t bit_number = end & (BitsPerWord - 1);
-    uintx element_bits = _bitmap[array_idx];
-    if (bit_number < BitsPerWord - 1){
-      uintx mask_in = tail_mask(bit_number + 1);
-      element_bits &= mask_in;
+  idx_t array_idx = end >> LogBitsPerWord;
+  const idx_t first_array_idx = (beg + 1) >> LogBitsPerWord;
+  uintx bit_number = end & (BitsPerWord - 1);
+  uintx element_bits = _bitmap[array_idx] & tail_mask(bit_number + 1);
+  // Skip over whole words without set bits
+  while (element_bits == 0) {
+    if (array_idx == first_array_idx) {
+      return beg;
     }
-    if (element_bits) {
-      // The prev set bit is here.  Find the first set bit <= bit_number
-      uintx aligned = element_bits << (BitsPerWord - (bit_number + 1));
-      uintx first_set_bit = count_leading_zeros<uintx>(aligned);
-      idx_t candidate_result = array_idx * BitsPerWord + (bit_number - first_set_bit);
-      return (candidate_result > beg)? candidate_result: beg;
-    } else {
-      // Next bit is not here.  Try the previous array element
-      end -= (bit_number + 1);
-    }
-  } while (end > beg);
-  return beg;
+    element_bits = _bitmap[--array_idx];
+  }
+  idx_t candidate_result = (array_idx * BitsPerWord) + (BitsPerWord - 1 - count_leading_zeros<uintx>(element_bits));
+  return (candidate_result > beg)? candidate_result: beg;
 }
 
 inline idx_t ShenandoahSimpleBitMap::find_last_set_bit(idx_t end) const {
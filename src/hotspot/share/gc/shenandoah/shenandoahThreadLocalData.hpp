@@ -59,6 +59,10 @@ class ShenandoahThreadLocalData {
 
   double _paced_time;
 
+  // Upper bound for the size of the next TLAB when pacing trickles
+  // allocations, in words. Zero when the thread is not throttled.
+  size_t _paced_tlab_size;
+
   // Thread-local allocation buffer only used in generational mode.
   // Used both by mutator threads and by GC worker threads
   // for evacuations within the old generation and
@@ -249,6 +253,14 @@ class ShenandoahThreadLocalData {
     data(thread)->_paced_time = 0;
   }
 
+  static void set_paced_tlab_size(Thread* thread, size_t v) {
+    data(thread)->_paced_tlab_size = v;
+  }
+
+  static size_t paced_tlab_size(Thread* thread) {
+    return data(thread)->_paced_tlab_size;
+  }
+
   // Evacuation OOM handling
   static bool is_oom_during_evac(Thread* thread) {
     return data(thread)->_oom_during_evac;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2016, 2021, Red Hat, Inc. All rights reserved.
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
@@ -251,6 +251,12 @@
           "Larger values give more weight to recent values.")               \
           range(0,1.0)                                                      \
                                                                             \
+  product(bool, ShenandoahAdaptivePredictCycleTime, false, EXPERIMENTAL,    \
+          "Predict the duration of the next cycle from the learned cost "   \
+          "of concurrent marking per byte of used memory and the learned "  \
+          "duration of the other phases, instead of using the average "     \
+          "cycle time.")                                                    \
+                                                                            \
   product(uintx, ShenandoahGuaranteedGCInterval, 5*60*1000, EXPERIMENTAL,   \
           "Many heuristics would guarantee a concurrent GC cycle at "       \
           "least with this interval. This is useful when large idle "       \
@@ -420,6 +426,12 @@
           "GC effectively stall the threads indefinitely instead of going " \
           "to degenerated or Full GC.")                                     \
                                                                             \
+  product(bool, ShenandoahPacingTrickle, false, EXPERIMENTAL,               \
+          "Throttle allocating threads by shrinking their TLABs when the "  \
+          "pacing budget is depleted, instead of stalling them. Each "      \
+          "thread halves its TLAB size on every refill that outpaces GC, "  \
+          "and doubles it again on refills covered by GC progress.")        \
+                                                                            \
   product(uintx, ShenandoahPacingIdleSlack, 2, EXPERIMENTAL,                \
           "How much of heap counted as non-taxable allocations during idle "\
           "phases. Larger value makes the pacing milder when collector is " \
@@ -476,6 +488,12 @@
           "humongous allocations, at the expense of higher GC copying "     \
           "costs. Currently affects stop-the-world (Full) cycle only.")     \
                                                                             \
+  product(bool, ShenandoahMutatorEvacRegionClaim, false, EXPERIMENTAL,      \
+          "Let only one mutator at a time evacuate from a given region in " \
+          "the load reference barrier slow path. Other mutators briefly "   \
+          "wait for the forwarded copy instead of racing to copy the same " \
+          "hot objects.")                                                   \
+                                                                            \
   product(bool, ShenandoahOOMDuringEvacALot, false, DIAGNOSTIC,             \
           "Testing: simulate OOM during evacuation.")                       \
                                                                             \
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -90,6 +90,7 @@ class ZBarrier : public AllStatic {
   static zaddress relocate_or_remap(zaddress_unsafe addr, ZGeneration* generation);
   static zaddress remap(zaddress_unsafe addr, ZGeneration* generation);
   static void remember(volatile zpointer* p);
+  static void remember_range(volatile zpointer* p, size_t length);
   static void mark_and_remember(volatile zpointer* p, zaddress addr);
 
   // Fast paths in increasing strength level
@@ -179,6 +180,11 @@ class ZBarrier : public AllStatic {
   static void store_barrier_on_heap_oop_field(volatile zpointer* p, bool heal);
   static void store_barrier_on_native_oop_field(volatile zpointer* p, bool heal);
 
+  // Store barrier for a range of heap oop fields, such as the destination
+  // of an oop arraycopy. Equivalent to applying the non-healing store barrier
+  // to each field, but remembers the whole range at once.
+  static void store_barrier_on_heap_oop_array(volatile zpointer* p, size_t length);
+
   static void no_keep_alive_store_barrier_on_heap_oop_field(volatile zpointer* p);
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -710,6 +710,30 @@ inline void ZBarrier::store_barrier_on_heap_oop_field(volatile zpointer* p, bool
   }
 }
 
+inline void ZBarrier::store_barrier_on_heap_oop_array(volatile zpointer* p, size_t length) {
+  bool needs_remember = false;
+
+  for (size_t i = 0; i < length; i++) {
+    const zpointer prev = load_atomic(p + i);
+    if (is_store_good_or_null_fast_path(prev)) {
+      // Already marked and remembered in this cycle
+      continue;
+    }
+
+    const zaddress addr = make_load_good(prev);
+    if (!is_null(addr)) {
+      mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
+    needs_remember = true;
+  }
+
+  if (needs_remember) {
+    // Remembering a superset of the fields that had store bad values
+    // is benign, the remembered set scanning handles any value.
+    remember_range(p, length);
+  }
+}
+
 inline void ZBarrier::store_barrier_on_native_oop_field(volatile zpointer* p, bool heal) {
   const zpointer prev = load_atomic(p);
 
@@ -736,6 +760,12 @@ inline void ZBarrier::remember(volatile zpointer* p) {
   }
 }
 
+inline void ZBarrier::remember_range(volatile zpointer* p, size_t length) {
+  if (ZHeap::heap()->is_old(p)) {
+    ZGeneration::young()->remember_range(p, length);
+  }
+}
+
 inline void ZBarrier::mark_and_remember(volatile zpointer* p, zaddress addr) {
   if (!is_null(addr)) {
     mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,7 @@ class ZBarrierSet : public BarrierSet {
 
     static void store_barrier_heap_with_healing(zpointer* p);
     static void store_barrier_heap_without_healing(zpointer* p);
+    static void store_barrier_heap_array_without_healing(zpointer* p, size_t length);
     static void no_keep_alive_store_barrier_heap(zpointer* p);
 
     static void store_barrier_native_with_healing(zpointer* p);
@@ -84,7 +85,7 @@ class ZBarrierSet : public BarrierSet {
 
     static zaddress oop_copy_one_barriers(zpointer* dst, zpointer* src);
     static bool oop_copy_one_check_cast(zpointer* dst, zpointer* src, Klass* dst_klass);
-    static void oop_copy_one(zpointer* dst, zpointer* src);
+    static void oop_copy_one_without_store_barrier(zpointer* dst, zpointer* src);
 
     static bool oop_arraycopy_in_heap_check_cast(zpointer* dst, zpointer* src, size_t length, Klass* dst_klass);
     static bool oop_arraycopy_in_heap_no_check_cast(zpointer* dst, zpointer* src, size_t length);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -139,6 +139,13 @@ inline void ZBarrierSet::AccessBarrier<decorators, BarrierSetT>::store_barrier_h
   }
 }
 
+template <DecoratorSet decorators, typename BarrierSetT>
+inline void ZBarrierSet::AccessBarrier<decorators, BarrierSetT>::store_barrier_heap_array_without_healing(zpointer* p, size_t length) {
+  if (!HasDecorator<decorators, IS_DEST_UNINITIALIZED>::value) {
+    ZBarrier::store_barrier_on_heap_oop_array(p, length);
+  }
+}
+
 template <DecoratorSet decorators, typename BarrierSetT>
 inline void ZBarrierSet::AccessBarrier<decorators, BarrierSetT>::no_keep_alive_store_barrier_heap(zpointer* p) {
   if (!HasDecorator<decorators, IS_DEST_UNINITIALIZED>::value) {
@@ -329,8 +336,8 @@ inline zaddress ZBarrierSet::AccessBarrier<decorators, BarrierSetT>::oop_copy_on
 }
 
 template <DecoratorSet decorators, typename BarrierSetT>
-inline void ZBarrierSet::AccessBarrier<decorators, BarrierSetT>::oop_copy_one(zpointer* dst, zpointer* src) {
-  const zaddress obj = oop_copy_one_barriers(dst, src);
+inline void ZBarrierSet::AccessBarrier<decorators, BarrierSetT>::oop_copy_one_without_store_barrier(zpointer* dst, zpointer* src) {
+  const zaddress obj = ZBarrier::load_barrier_on_oop_field(src);
 
   Atomic::store(dst, ZAddress::store_good(obj));
 }
@@ -367,24 +374,32 @@ template <DecoratorSet decorators, typename BarrierSetT>
 inline bool ZBarrierSet::AccessBarrier<decorators, BarrierSetT>::oop_arraycopy_in_heap_no_check_cast(zpointer* dst, zpointer* src, size_t length) {
   const bool is_disjoint = HasDecorator<decorators, ARRAYCOPY_DISJOINT>::value;
 
+  if (src == dst) {
+    // src and dst are the same; nothing to do
+    return true;
+  }
+
+  // Apply the store barriers for the whole destination range up front,
+  // which only needs to look up and remember the destination page once.
+  // The previous values in the destination are not overwritten until the
+  // copy below, so this is equivalent to applying them one at a time.
+  store_barrier_heap_array_without_healing(dst, length);
+
   if (is_disjoint || src > dst) {
     for (const zpointer* const end = src + length; src < end; src++, dst++) {
-      oop_copy_one(dst, src);
+      oop_copy_one_without_store_barrier(dst, src);
     }
     return true;
   }
 
-  if (src < dst) {
-    const zpointer* const end = src;
-    src += length - 1;
-    dst += length - 1;
-    for ( ; src >= end; src--, dst--) {
-      oop_copy_one(dst, src);
-    }
-    return true;
+  // Backward copy for overlapping ranges
+  const zpointer* const end = src;
+  src += length - 1;
+  dst += length - 1;
+  for ( ; src >= end; src--, dst--) {
+    oop_copy_one_without_store_barrier(dst, src);
   }
 
-  // src and dst are the same; nothing to do
   return true;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 #include "gc/z/zHeuristics.hpp"
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 
 #include <limits>
@@ -79,6 +80,28 @@ ZDirector::ZDirector()
   create_and_start();
 }
 
+// The allocation rate rules are evaluated on every director tick, so the
+// forecast is only sent when it triggers a collection.
+static void send_allocation_rate_forecast(const ZStatMutatorAllocRateStats& alloc_rate_stats,
+                                          double max_alloc_rate,
+                                          size_t free,
+                                          double time_until_oom,
+                                          double gc_duration,
+                                          double time_until_gc) {
+  EventZAllocationRateForecast event;
+  if (event.should_commit()) {
+    event.set_averageAllocationRate(alloc_rate_stats._avg);
+    event.set_predictedAllocationRate(alloc_rate_stats._predict);
+    event.set_burstAllocationRate(alloc_rate_stats._burst);
+    event.set_maxAllocationRate(max_alloc_rate);
+    event.set_free(free);
+    event.set_timeUntilOOM((jlong)(time_until_oom * MILLIUNITS));
+    event.set_gcDuration((jlong)(gc_duration * MILLIUNITS));
+    event.set_margin((jlong)(time_until_gc * MILLIUNITS));
+    event.commit();
+  }
+}
+
 // Minor GC rules
 
 static bool rule_minor_timer(const ZDirectorStats& stats) {
@@ -165,13 +188,16 @@ static ZDriverRequest rule_minor_allocation_rate_dynamic(const ZDirectorStats& s
   // that with an allocation spike tolerance factor to guard against unforeseen
   // phase changes in the allocate rate. We then add ~3.3 sigma to account for
   // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
+  // that a sample is outside of the confidence interval. The conservative
+  // rate is never below the recently seen burst rate, since recurring
+  // allocation bursts are smoothed out by the moving average.
   const ZStatMutatorAllocRateStats alloc_rate_stats = stats._mutator_alloc_rate;
   const double alloc_rate_predict = alloc_rate_stats._predict;
   const double alloc_rate_avg = alloc_rate_stats._avg;
   const double alloc_rate_sd = alloc_rate_stats._sd;
   const double alloc_rate_sd_percent = alloc_rate_sd / (alloc_rate_avg + 1.0);
-  const double alloc_rate_conservative = (MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * one_in_1000) + 1.0;
+  const double alloc_rate_conservative = MAX2((MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * one_in_1000),
+                                              alloc_rate_stats._burst) + 1.0;
   const double alloc_rate = conservative_alloc_rate ? alloc_rate_conservative : alloc_rate_stats._avg;
   const double time_until_oom = (free / alloc_rate) / (1.0 + alloc_rate_sd_percent);
 
@@ -212,6 +238,10 @@ static ZDriverRequest rule_minor_allocation_rate_dynamic(const ZDirectorStats& s
     return ZDriverRequest(GCCause::_no_gc, actual_gc_workers, 0);
   }
 
+  if (conservative_alloc_rate) {
+    send_allocation_rate_forecast(alloc_rate_stats, alloc_rate, free, time_until_oom, actual_gc_duration, time_until_gc);
+  }
+
   return ZDriverRequest(GCCause::_z_allocation_rate, actual_gc_workers, 0);
 }
 
@@ -269,9 +299,11 @@ static bool rule_minor_allocation_rate_static(const ZDirectorStats& stats) {
   // that with an allocation spike tolerance factor to guard against unforeseen
   // phase changes in the allocate rate. We then add ~3.3 sigma to account for
   // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
+  // that a sample is outside of the confidence interval. The max rate is
+  // never below the recently seen burst rate.
   const ZStatMutatorAllocRateStats alloc_rate_stats = stats._mutator_alloc_rate;
-  const double max_alloc_rate = (alloc_rate_stats._avg * ZAllocationSpikeTolerance) + (alloc_rate_stats._sd * one_in_1000);
+  const double max_alloc_rate = MAX2((alloc_rate_stats._avg * ZAllocationSpikeTolerance) + (alloc_rate_stats._sd * one_in_1000),
+                                     alloc_rate_stats._burst);
   const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
 
   // Calculate max serial/parallel times of a GC cycle. The times are
@@ -287,10 +319,16 @@ static bool rule_minor_allocation_rate_static(const ZDirectorStats& stats) {
   // time and end up starting the GC too late in the next interval.
   const double time_until_gc = time_until_oom - gc_duration;
 
-  log_debug(gc, director)("Rule Minor: Allocation Rate (Static GC Workers), MaxAllocRate: %.1fMB/s, Free: %zuMB, GCDuration: %.3fs, TimeUntilGC: %.3fs",
-                          max_alloc_rate / M, free / M, gc_duration, time_until_gc);
+  log_debug(gc, director)("Rule Minor: Allocation Rate (Static GC Workers), MaxAllocRate: %.1fMB/s, BurstAllocRate: %.1fMB/s, Free: %zuMB, GCDuration: %.3fs, TimeUntilGC: %.3fs",
+                          max_alloc_rate / M, alloc_rate_stats._burst / M, free / M, gc_duration, time_until_gc);
 
-  return time_until_gc <= 0;
+  if (time_until_gc > 0) {
+    return false;
+  }
+
+  send_allocation_rate_forecast(alloc_rate_stats, max_alloc_rate, free, time_until_oom, gc_duration, time_until_gc);
+
+  return true;
 }
 
 static bool is_young_small(const ZDirectorStats& stats) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,10 @@ class ZForwarding {
   };
 
 private:
+  // Pages with at least this percentage of live bytes get a more
+  // densely populated forwarding table
+  static const size_t DenseLivePercent = 50;
+
   typedef ZAttachedArray<ZForwarding, ZForwardingEntry> AttachedArray;
   typedef ZArray<volatile zpointer*> PointerArray;
 
@@ -97,6 +101,7 @@ class ZForwarding {
   ZForwarding(ZPage* page, ZPageAge to_age, size_t nentries);
 
 public:
+  static bool is_dense(const ZPage* page);
   static uint32_t nentries(const ZPage* page);
   static ZForwarding* alloc(ZForwardingAllocator* allocator, ZPage* page, ZPageAge to_age);
 
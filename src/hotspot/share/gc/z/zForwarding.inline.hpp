@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,10 @@
 #include "utilities/debug.hpp"
 #include "utilities/powerOfTwo.hpp"
 
+inline bool ZForwarding::is_dense(const ZPage* page) {
+  return page->live_bytes() >= page->size() * DenseLivePercent / 100;
+}
+
 inline uint32_t ZForwarding::nentries(const ZPage* page) {
   // The number returned by the function is used to size the hash table of
   // forwarding entries for this page. This hash table uses linear probing.
@@ -47,7 +51,17 @@ inline uint32_t ZForwarding::nentries(const ZPage* page) {
   // inexpensive indexing/masking. The table is also sized to have a load
   // factor of 50%, i.e. sized to have double the number of entries actually
   // inserted, to allow for good lookup/insert performance.
-  return round_up_power_of_2(page->live_objects() * 2);
+  //
+  // For dense pages the table can otherwise be a significant fraction of
+  // the page size, so those are instead sized for a load factor of at most
+  // two thirds. There is always at least one empty entry, which terminates
+  // the linear probing.
+  const uint32_t live_objects = page->live_objects();
+  if (is_dense(page)) {
+    return round_up_power_of_2(live_objects + (live_objects / 2) + 1);
+  }
+
+  return round_up_power_of_2(live_objects * 2);
 }
 
 inline ZForwarding* ZForwarding::alloc(ZForwardingAllocator* allocator, ZPage* page, ZPageAge to_age) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -247,6 +247,7 @@ class ZGenerationYoung : public ZGeneration {
 
   // Add remembered set entries
   void remember(volatile zpointer* p);
+  void remember_range(volatile zpointer* p, size_t length);
   void remember_fields(zaddress addr);
 
   // Scan a remembered set entry
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -159,6 +159,10 @@ inline void ZGenerationYoung::remember(volatile zpointer* p) {
   _remembered.remember(p);
 }
 
+inline void ZGenerationYoung::remember_range(volatile zpointer* p, size_t length) {
+  _remembered.remember_range(p, length);
+}
+
 inline void ZGenerationYoung::scan_remembered_field(volatile zpointer* p) {
   _remembered.scan_field(p);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -21,16 +21,20 @@
  * questions.
  */
 
+#include "code/nmethod.hpp"
 #include "gc/z/zNMethodTableEntry.hpp"
 #include "gc/z/zNMethodTableIteration.hpp"
 #include "memory/iterator.hpp"
 #include "runtime/atomic.hpp"
+#include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 ZNMethodTableIteration::ZNMethodTableIteration()
   : _table(nullptr),
     _size(0),
+    _visited(mtGC),
+    _claimed_recent(0),
     _claimed(0) {}
 
 bool ZNMethodTableIteration::in_progress() const {
@@ -42,6 +46,8 @@ void ZNMethodTableIteration::nmethods_do_begin(ZNMethodTableEntry* table, size_t
 
   _table = table;
   _size = size;
+  _visited.reinitialize(size);
+  _claimed_recent = 0;
   _claimed = 0;
 }
 
@@ -50,24 +56,41 @@ void ZNMethodTableIteration::nmethods_do_end() {
 
   // Finish iteration
   _table = nullptr;
+  _visited.reinitialize(0);
+}
+
+bool ZNMethodTableIteration::claim_partition(volatile size_t* claimed, size_t* partition_start, size_t* partition_end) {
+  // Claim table partition. Each partition is currently sized to span
+  // two cache lines. This number is just a guess, but seems to work well.
+  const size_t partition_size = (ZCacheLineSize * 2) / sizeof(ZNMethodTableEntry);
+  *partition_start = MIN2(Atomic::fetch_then_add(claimed, partition_size), _size);
+  *partition_end = MIN2(*partition_start + partition_size, _size);
+  return *partition_start != *partition_end;
+}
+
+bool ZNMethodTableIteration::claim_entry(size_t index) {
+  return _visited.par_set_bit(index);
 }
 
 void ZNMethodTableIteration::nmethods_do(NMethodClosure* cl) {
-  for (;;) {
-    // Claim table partition. Each partition is currently sized to span
-    // two cache lines. This number is just a guess, but seems to work well.
-    const size_t partition_size = (ZCacheLineSize * 2) / sizeof(ZNMethodTableEntry);
-    const size_t partition_start = MIN2(Atomic::fetch_then_add(&_claimed, partition_size), _size);
-    const size_t partition_end = MIN2(partition_start + partition_size, _size);
-    if (partition_start == partition_end) {
-      // End of table
-      break;
+  size_t partition_start;
+  size_t partition_end;
+
+  // Process recently entered nmethods first
+  while (claim_partition(&_claimed_recent, &partition_start, &partition_end)) {
+    for (size_t i = partition_start; i < partition_end; i++) {
+      const ZNMethodTableEntry entry = _table[i];
+      if (entry.registered() && entry.method()->is_maybe_on_stack() && claim_entry(i)) {
+        cl->do_nmethod(entry.method());
+      }
     }
+  }
 
-    // Process table partition
+  // Process the remaining nmethods
+  while (claim_partition(&_claimed, &partition_start, &partition_end)) {
     for (size_t i = partition_start; i < partition_end; i++) {
       const ZNMethodTableEntry entry = _table[i];
-      if (entry.registered()) {
+      if (entry.registered() && claim_entry(i)) {
         cl->do_nmethod(entry.method());
       }
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,27 @@
 #define SHARE_GC_Z_ZNMETHODTABLEITERATION_HPP
 
 #include "gc/z/zGlobals.hpp"
+#include "utilities/bitMap.hpp"
 
 class NMethodClosure;
 class ZNMethodTableEntry;
 
+// The table is iterated in two passes. The first pass only visits nmethods
+// which have been entered recently, so that these are processed before the
+// mutators hit their entry barriers. The second pass visits the rest. Each
+// entry is claimed in the visited bitmap, so that it is visited exactly once
+// even if it becomes recently entered while the iteration is in progress.
 class ZNMethodTableIteration {
 private:
   ZNMethodTableEntry*            _table;
   size_t                         _size;
+  CHeapBitMap                    _visited;
+  ZCACHE_ALIGNED volatile size_t _claimed_recent;
   ZCACHE_ALIGNED volatile size_t _claimed;
 
+  bool claim_partition(volatile size_t* claimed, size_t* partition_start, size_t* partition_end);
+  bool claim_entry(size_t index);
+
 public:
   ZNMethodTableIteration();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeuristics.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zObjectAllocator.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -36,6 +37,7 @@
 #include "runtime/thread.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 static const ZStatCounter ZCounterUndoObjectAllocationSucceeded("Memory", "Undo Object Allocation Succeeded", ZStatUnitOpsPerSecond);
 static const ZStatCounter ZCounterUndoObjectAllocationFailed("Memory", "Undo Object Allocation Failed", ZStatUnitOpsPerSecond);
@@ -45,7 +47,8 @@ ZObjectAllocator::ZObjectAllocator(ZPageAge age)
     _use_per_cpu_shared_small_pages(ZHeuristics::use_per_cpu_shared_small_pages()),
     _shared_small_page(nullptr),
     _shared_medium_page(nullptr),
-    _medium_page_alloc_lock() {}
+    _medium_page_alloc_lock(),
+    _medium_size_histogram() {}
 
 ZPage** ZObjectAllocator::shared_small_page_addr() {
   return _use_per_cpu_shared_small_pages ? _shared_small_page.addr() : _shared_small_page.addr(0);
@@ -56,11 +59,11 @@ ZPage* const* ZObjectAllocator::shared_small_page_addr() const {
 }
 
 ZPage* ZObjectAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags) {
-  return ZHeap::heap()->alloc_page(type, size, flags, _age);
+  return ZHeap::heap()->alloc_page(type, size, flags, _age, ZNUMA::id());
 }
 
-ZPage* ZObjectAllocator::alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags) {
-  return ZHeap::heap()->alloc_page(type, size, flags, _age);
+ZPage* ZObjectAllocator::alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t numa_id) {
+  return ZHeap::heap()->alloc_page(type, size, flags, _age, numa_id);
 }
 
 void ZObjectAllocator::undo_alloc_page(ZPage* page) {
@@ -116,9 +119,57 @@ zaddress ZObjectAllocator::alloc_object_in_shared_page(ZPage** shared_page,
   return addr;
 }
 
+void ZObjectAllocator::record_medium_object_size(size_t size) {
+  const int shift = log2i(size - 1) - log2i(ZObjectSizeLimitSmall);
+  const uint bucket = MIN2((uint)MAX2(shift, 0), MediumSizeHistogramBuckets - 1);
+  Atomic::inc(&_medium_size_histogram[bucket], memory_order_relaxed);
+}
+
+size_t ZObjectAllocator::medium_page_size() {
+  if (ZPageSizeMediumMin == ZPageSizeMediumMax) {
+    // Only a single medium page size is used
+    return ZPageSizeMediumMax;
+  }
+
+  uint histogram[MediumSizeHistogramBuckets];
+  uint total = 0;
+  for (uint i = 0; i < MediumSizeHistogramBuckets; i++) {
+    histogram[i] = Atomic::load(&_medium_size_histogram[i]);
+    total += histogram[i];
+  }
+
+  if (total < MediumSizeHistogramMinSamples) {
+    // Not enough samples yet
+    return ZPageSizeMediumMax;
+  }
+
+  if (total > MediumSizeHistogramMaxSamples) {
+    // Decay old samples to adapt to changes in the allocation pattern.
+    // Racing increments may be lost, which is fine for a heuristic.
+    for (uint i = 0; i < MediumSizeHistogramBuckets; i++) {
+      Atomic::store(&_medium_size_histogram[i], histogram[i] / 2);
+    }
+  }
+
+  // Find the bucket containing the 90th percentile of the object sizes
+  const uint target = total - total / 10;
+  uint bucket = 0;
+  for (uint accumulated = histogram[0]; accumulated < target; accumulated += histogram[bucket]) {
+    bucket++;
+  }
+
+  // Size the page so that a percentile sized object has the same relative
+  // size to the page as the largest medium object has to max sized page.
+  const size_t object_size = MIN2(ZObjectSizeLimitSmall << (bucket + 1), ZObjectSizeLimitMedium);
+  const size_t page_size = round_up_power_of_2(object_size * (ZPageSizeMediumMax / ZObjectSizeLimitMedium));
+
+  return clamp(page_size, ZPageSizeMediumMin, ZPageSizeMediumMax);
+}
+
 zaddress ZObjectAllocator::alloc_object_in_medium_page(size_t size,
                                                        ZAllocationFlags flags) {
   zaddress addr = zaddress::null;
+  size_t page_size = ZPageSizeMediumMax;
   ZPage** shared_medium_page = _shared_medium_page.addr();
   ZPage* page = Atomic::load_acquire(shared_medium_page);
 
@@ -133,6 +184,8 @@ zaddress ZObjectAllocator::alloc_object_in_medium_page(size_t size,
     // the page at this layer.
     ZLocker<ZLock> locker(&_medium_page_alloc_lock);
 
+    page_size = medium_page_size();
+
     // When holding the lock we can't allow the page allocator to stall,
     // which in the common case it won't. The page allocation is thus done
     // in a non-blocking fashion and only if this fails we below (while not
@@ -151,7 +204,7 @@ zaddress ZObjectAllocator::alloc_object_in_medium_page(size_t size,
     }
 
     if (is_null(addr)) {
-      addr = alloc_object_in_shared_page(shared_medium_page, ZPageType::medium, ZPageSizeMediumMax, size, non_blocking_flags);
+      addr = alloc_object_in_shared_page(shared_medium_page, ZPageType::medium, page_size, size, non_blocking_flags);
     }
 
   }
@@ -159,7 +212,7 @@ zaddress ZObjectAllocator::alloc_object_in_medium_page(size_t size,
   if (is_null(addr) && !flags.non_blocking()) {
     // The above allocation attempts failed and this allocation should stall
     // until memory is available. Redo the allocation with blocking enabled.
-    addr = alloc_object_in_shared_page(shared_medium_page, ZPageType::medium, ZPageSizeMediumMax, size, flags);
+    addr = alloc_object_in_shared_page(shared_medium_page, ZPageType::medium, page_size, size, flags);
   }
 
   return addr;
@@ -180,6 +233,7 @@ zaddress ZObjectAllocator::alloc_large_object(size_t size, ZAllocationFlags flag
 }
 
 zaddress ZObjectAllocator::alloc_medium_object(size_t size, ZAllocationFlags flags) {
+  record_medium_object_size(size);
   return alloc_object_in_medium_page(size, flags);
 }
 
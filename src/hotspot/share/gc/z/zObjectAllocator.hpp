@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,11 +36,18 @@ class ZPageTable;
 
 class ZObjectAllocator {
 private:
+  // Medium object sizes are recorded in power of two buckets, starting
+  // with the sizes just above the small object size limit.
+  static const uint MediumSizeHistogramBuckets = 8;
+  static const uint MediumSizeHistogramMinSamples = 64;
+  static const uint MediumSizeHistogramMaxSamples = 4096;
+
   ZPageAge           _age;
   const bool         _use_per_cpu_shared_small_pages;
   ZPerCPU<ZPage*>    _shared_small_page;
   ZContended<ZPage*> _shared_medium_page;
   ZLock              _medium_page_alloc_lock;
+  volatile uint      _medium_size_histogram[MediumSizeHistogramBuckets];
 
   ZPage** shared_small_page_addr();
   ZPage* const* shared_small_page_addr() const;
@@ -59,6 +66,12 @@ class ZObjectAllocator {
   zaddress alloc_object_in_medium_page(size_t size,
                                        ZAllocationFlags flags);
 
+  void record_medium_object_size(size_t size);
+
+  // Select the size of the next medium page from the recorded medium
+  // object sizes, such that most objects fit as with the max page size.
+  size_t medium_page_size();
+
   zaddress alloc_large_object(size_t size, ZAllocationFlags flags);
   zaddress alloc_medium_object(size_t size, ZAllocationFlags flags);
   zaddress alloc_small_object(size_t size, ZAllocationFlags flags);
@@ -74,7 +87,7 @@ class ZObjectAllocator {
   zaddress alloc_object_for_relocation(size_t size);
   void undo_alloc_object_for_relocation(zaddress addr, size_t size);
 
-  ZPage* alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags);
+  ZPage* alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t numa_id);
 
   ZPageAge age() const;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -138,6 +138,7 @@ class ZPage : public CHeapObj<mtGC> {
   void object_iterate(Function function);
 
   void remember(volatile zpointer* p);
+  void remember_range(volatile zpointer* p, size_t length);
 
   // In-place relocation support
   void clear_remset_bit_non_par_current(uintptr_t l_offset);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -335,6 +335,12 @@ inline void ZPage::remember(volatile zpointer* p) {
   _remembered_set.set_current(l_offset);
 }
 
+inline void ZPage::remember_range(volatile zpointer* p, size_t length) {
+  const zaddress addr = to_zaddress((uintptr_t)p);
+  const uintptr_t l_offset = local_offset(addr);
+  _remembered_set.set_range_current(l_offset, length * sizeof(zpointer));
+}
+
 inline void ZPage::clear_remset_bit_non_par_current(uintptr_t l_offset) {
   _remembered_set.unset_non_par_current(l_offset);
 }
@@ -407,6 +413,11 @@ inline void ZPage::oops_do_remembered_in_live(Function function) {
   assert(!ZGeneration::old()->is_phase_mark(), "Must have liveness information");
   assert(is_marked(), "Must have liveness information");
 
+  if (!_remembered_set.is_dirty_previous()) {
+    // No remembered fields recorded
+    return;
+  }
+
   ZRememberedSetContainingInLiveIterator iter(this);
   for (ZRememberedSetContaining containing; iter.next(&containing);) {
     function((volatile zpointer*)containing._field_addr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -70,6 +70,9 @@ class ZMemoryAllocation;
 static const ZStatCounter       ZCounterMutatorAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterMappedCacheHarvest("Memory", "Mapped Cache Harvest", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterDefragment("Memory", "Defragment", ZStatUnitOpsPerSecond);
+static const ZStatCounter       ZCounterMappedCacheHit("Memory", "Mapped Cache Hit", ZStatUnitOpsPerSecond);
+static const ZStatCounter       ZCounterMappedCacheMiss("Memory", "Mapped Cache Miss", ZStatUnitOpsPerSecond);
+static const ZStatCounter       ZCounterRemotePartitionAllocation("Memory", "Remote Partition Allocation", ZStatUnitOpsPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
 
 static void check_numa_mismatch(const ZVirtualMemory& vmem, uint32_t desired_id) {
@@ -420,7 +423,7 @@ class ZPageAllocation : public StackObj {
   ZFuture<bool>              _stall_result;
 
 public:
-  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age)
+  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t numa_id)
     : _type(type),
       _requested_size(size),
       _flags(flags),
@@ -428,7 +431,7 @@ class ZPageAllocation : public StackObj {
       _start_timestamp(Ticks::now()),
       _young_seqnum(ZGeneration::young()->seqnum()),
       _old_seqnum(ZGeneration::old()->seqnum()),
-      _initiating_numa_id(ZNUMA::id()),
+      _initiating_numa_id(numa_id),
       _is_multi_partition(false),
       _single_partition_allocation(size),
       _multi_partition_allocation(size),
@@ -630,6 +633,8 @@ ZPartition::ZPartition(uint32_t numa_id, ZPageAllocator* page_allocator)
     _capacity(0),
     _claimed(0),
     _used(0),
+    _cache_hits(0),
+    _cache_misses(0),
     _numa_id(numa_id) {}
 
 uint32_t ZPartition::numa_id() const {
@@ -709,11 +714,16 @@ void ZPartition::claim_from_cache_or_increase_capacity(ZMemoryAllocation* alloca
   if (!vmem.is_null()) {
     // Found a satisfying vmem in the cache
     allocation->set_satisfied_from_cache_vmem(vmem);
+    _cache_hits++;
+    ZStatInc(ZCounterMappedCacheHit);
 
     // Done
     return;
   }
 
+  _cache_misses++;
+  ZStatInc(ZCounterMappedCacheMiss);
+
   // Try increase capacity
   const size_t increased_capacity = increase_capacity(size);
 
@@ -771,6 +781,8 @@ bool ZPartition::claim_capacity_fast_medium(ZMemoryAllocation* allocation) {
 
   // Found a satisfying vmem in the cache
   allocation->set_satisfied_from_cache_vmem_fast_medium(vmem);
+  _cache_hits++;
+  ZStatInc(ZCounterMappedCacheHit);
 
   // Associate the allocation with this partition.
   allocation->set_partition(this);
@@ -1104,8 +1116,8 @@ void ZPartition::threads_do(ThreadClosure* tc) const {
 void ZPartition::print_on(outputStream* st) const {
   st->print("Partition %u ", _numa_id);
   st->fill_to(17);
-  st->print_cr("used %zuM, capacity %zuM, max capacity %zuM",
-               _used / M, _capacity / M, _max_capacity / M);
+  st->print_cr("used %zuM, capacity %zuM, max capacity %zuM, cache hits %zu, cache misses %zu",
+               _used / M, _capacity / M, _max_capacity / M, _cache_hits, _cache_misses);
 
   StreamIndentor si(st, 1);
   print_cache_on(st);
@@ -1394,10 +1406,10 @@ static void check_out_of_memory_during_initialization() {
   }
 }
 
-ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age) {
+ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t numa_id) {
   EventZPageAllocation event;
 
-  ZPageAllocation allocation(type, size, flags, age);
+  ZPageAllocation allocation(type, size, flags, age, numa_id);
 
   // Allocate the page
   ZPage* const page = alloc_page_inner(&allocation);
@@ -1553,6 +1565,9 @@ bool ZPageAllocator::claim_capacity(ZPageAllocation* allocation) {
     const uint32_t partition_id = (start_partition + i) % num_partitions;
 
     if (claim_capacity_single_partition(allocation->single_partition_allocation(), partition_id)) {
+      if (i != 0) {
+        ZStatInc(ZCounterRemotePartitionAllocation);
+      }
       return true;
     }
   }
@@ -1584,6 +1599,9 @@ bool ZPageAllocator::claim_capacity_fast_medium(ZPageAllocation* allocation) {
     ZSinglePartitionAllocation* single_partition_allocation = allocation->single_partition_allocation();
 
     if (partition.claim_capacity_fast_medium(single_partition_allocation->allocation())) {
+      if (i != 0) {
+        ZStatInc(ZCounterRemotePartitionAllocation);
+      }
       return true;
     }
   }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -385,7 +386,15 @@ zaddress ZRelocate::forward_object(ZForwarding* forwarding, zaddress_unsafe from
   return to_addr;
 }
 
-static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, size_t size) {
+static uint32_t relocation_numa_id(ZForwarding* forwarding) {
+  // Keep relocated objects on the NUMA node of the page they are relocated
+  // from, which is the node of the thread that allocated them, rather than
+  // moving them to the node of the relocating GC thread.
+  const ZPage* const page = forwarding->page();
+  return page->is_multi_partition() ? ZNUMA::id() : page->single_partition_id();
+}
+
+static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZForwarding* forwarding) {
   if (ZStressRelocateInPlace) {
     // Simulate failure to allocate a new page. This will
     // cause the page being relocated to be relocated in-place.
@@ -396,7 +405,7 @@ static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, siz
   flags.set_non_blocking();
   flags.set_gc_relocation();
 
-  return allocator->alloc_page_for_relocation(type, size, flags);
+  return allocator->alloc_page_for_relocation(forwarding->type(), forwarding->size(), flags, relocation_numa_id(forwarding));
 }
 
 static void retire_target_page(ZGeneration* generation, ZPage* page) {
@@ -427,7 +436,7 @@ class ZRelocateSmallAllocator {
 
   ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
     ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size());
+    ZPage* const page = alloc_page(allocator, forwarding);
     if (page == nullptr) {
       Atomic::inc(&_in_place_count);
     }
@@ -510,7 +519,7 @@ class ZRelocateMediumAllocator {
     const ZPageAge to_age = forwarding->to_age();
     if (shared(to_age) == target) {
       ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-      ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size());
+      ZPage* const to_page = alloc_page(allocator, forwarding);
       set_shared(to_age, to_page);
       if (to_page == nullptr) {
         Atomic::inc(&_in_place_count);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -203,11 +203,21 @@ void ZRelocationSetSelectorGroup::select() {
   for (uint i = 0; i <= ZPageAgeMax; ++i) {
     s._npages_candidates += _stats[i].npages_candidates();
     s._total += _stats[i].total();
+    s._live += _stats[i].live();
     s._empty += _stats[i].empty();
     s._npages_selected += _stats[i].npages_selected();
     s._relocate += _stats[i].relocate();
   }
 
+  if (_page_type == ZPageType::medium && s._npages_candidates > 0) {
+    // Medium pages are sized from the observed allocation sizes, report how
+    // large they ended up being and how much of them is garbage.
+    const size_t candidates_total = s._total - s._empty;
+    log_debug(gc, reloc)("Relocation Set (%s Pages) Candidates: %zu pages, average size %zuM, %.1f%% fragmentation",
+                         _name, s._npages_candidates, s._total / s._npages_candidates / M,
+                         candidates_total > 0 ? percent_of(candidates_total - s._live, candidates_total) : 0.0);
+  }
+
   // Send event
   event.commit((u8)_page_type, s._npages_candidates, s._total, s._empty, s._npages_selected, s._relocate);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -85,6 +85,7 @@ class ZRemembered {
 
   // Add to remembered set
   void remember(volatile zpointer* p) const;
+  void remember_range(volatile zpointer* p, size_t length) const;
 
   // Scan all remembered sets and follow
   void scan_and_follow(ZMark* mark);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,13 @@ inline void ZRemembered::remember(volatile zpointer* p) const {
   page->remember(p);
 }
 
+inline void ZRemembered::remember_range(volatile zpointer* p, size_t length) const {
+  ZPage* page = _page_table->get(p);
+  assert(page != nullptr,  "Page missing in page table");
+  assert(page == _page_table->get(p + length - 1), "Range must be within a single page");
+  page->remember_range(p, length);
+}
+
 inline bool ZRemembered::is_remembered(volatile zpointer* p) const {
   ZPage* page = _page_table->get(p);
   assert(page != nullptr,  "Page missing in page table");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/iterator.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 int ZRememberedSet::_current = 0;
@@ -38,7 +39,8 @@ void ZRememberedSet::flip() {
 }
 
 ZRememberedSet::ZRememberedSet()
-  : _bitmap{ZMovableBitMap(), ZMovableBitMap()} {
+  : _bitmap{ZMovableBitMap(), ZMovableBitMap()},
+    _dirty{false, false} {
   // Defer initialization of the bitmaps until the owning
   // page becomes old and its remembered set is initialized.
 }
@@ -52,6 +54,8 @@ void ZRememberedSet::initialize(size_t page_size) {
   const BitMap::idx_t size_in_bits = to_bit_size(page_size);
   _bitmap[0].initialize(size_in_bits, true /* clear */);
   _bitmap[1].initialize(size_in_bits, true /* clear */);
+  _dirty[0] = false;
+  _dirty[1] = false;
 }
 
 bool ZRememberedSet::is_cleared_current() const {
@@ -63,16 +67,26 @@ bool ZRememberedSet::is_cleared_previous() const {
 }
 
 void ZRememberedSet::clear_previous() {
-  previous()->clear_large();
+  if (is_dirty_previous()) {
+    previous()->clear_large();
+    Atomic::store(&_dirty[_current ^ 1], false);
+  }
 }
 
 void ZRememberedSet::swap_remset_bitmaps() {
   assert(previous()->is_empty(), "Previous remset bits should be empty when swapping");
+  if (!is_dirty_current()) {
+    // Nothing to move
+    return;
+  }
+
   current()->iterate([&](BitMap::idx_t index) {
     previous()->set_bit(index);
     return true;
   });
+  Atomic::store(&_dirty[_current ^ 1], true);
   current()->clear_large();
+  Atomic::store(&_dirty[_current], false);
 }
 
 ZBitMap::ReverseIterator ZRememberedSet::iterator_reverse_previous() {
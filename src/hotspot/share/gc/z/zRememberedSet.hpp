@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,10 @@ class ZRememberedSetContainingInLiveIterator {
 // New entries are added to the "current" active bitmap, while the
 // "previous" bitmap is used by the GC to find pointers from old
 // gen to young gen.
+//
+// Each bitmap has a dirty summary which is set when the first bit is set in
+// it, and cleared together with the bitmap. It allows the GC to skip the
+// bitmap iteration of pages which had no remembered fields recorded.
 class ZRememberedSet {
   friend class ZRememberedSetContainingIterator;
 
@@ -93,6 +97,7 @@ class ZRememberedSet {
   static int _current;
 
   ZMovableBitMap _bitmap[2];
+  volatile bool  _dirty[2];
 
   CHeapBitMap* current();
   const CHeapBitMap* current() const;
@@ -118,6 +123,7 @@ class ZRememberedSet {
   bool at_current(uintptr_t offset) const;
   bool at_previous(uintptr_t offset) const;
   bool set_current(uintptr_t offset);
+  void set_range_current(uintptr_t offset, size_t size);
   void unset_non_par_current(uintptr_t offset);
   void unset_range_non_par_current(uintptr_t offset, size_t size);
 
@@ -131,6 +137,10 @@ class ZRememberedSet {
   bool is_cleared_current() const;
   bool is_cleared_previous() const;
 
+  // Returns false if no bits have been set since the bitmap was last cleared.
+  bool is_dirty_current() const;
+  bool is_dirty_previous() const;
+
   void clear_previous();
   void swap_remset_bitmaps();
 
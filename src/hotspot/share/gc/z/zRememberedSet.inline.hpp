@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 
 #include "gc/z/zRememberedSet.hpp"
 
+#include "runtime/atomic.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 inline CHeapBitMap* ZRememberedSet::current() {
@@ -70,7 +71,35 @@ inline bool ZRememberedSet::at_previous(uintptr_t offset) const {
 
 inline bool ZRememberedSet::set_current(uintptr_t offset) {
   const BitMap::idx_t index = to_index(offset);
-  return current()->par_set_bit(index, memory_order_relaxed);
+  const int current_index = _current;
+  if (!_bitmap[current_index].par_set_bit(index, memory_order_relaxed)) {
+    return false;
+  }
+
+  if (!Atomic::load(&_dirty[current_index])) {
+    Atomic::store(&_dirty[current_index], true);
+  }
+
+  return true;
+}
+
+inline void ZRememberedSet::set_range_current(uintptr_t offset, size_t size) {
+  const BitMap::idx_t start_index = to_index(offset);
+  const BitMap::idx_t end_index = to_index(offset + size);
+  const int current_index = _current;
+  _bitmap[current_index].par_set_range(start_index, end_index, BitMap::unknown_range);
+
+  if (!Atomic::load(&_dirty[current_index])) {
+    Atomic::store(&_dirty[current_index], true);
+  }
+}
+
+inline bool ZRememberedSet::is_dirty_current() const {
+  return Atomic::load(&_dirty[_current]);
+}
+
+inline bool ZRememberedSet::is_dirty_previous() const {
+  return Atomic::load(&_dirty[_current ^ 1]);
 }
 
 inline void ZRememberedSet::unset_non_par_current(uintptr_t offset) {
@@ -97,12 +126,16 @@ void ZRememberedSet::iterate_bitmap(Function function, CHeapBitMap* bitmap) {
 
 template <typename Function>
 void ZRememberedSet::iterate_previous(Function function) {
-  iterate_bitmap(function, previous());
+  if (is_dirty_previous()) {
+    iterate_bitmap(function, previous());
+  }
 }
 
 template <typename Function>
 void ZRememberedSet::iterate_current(Function function) {
-  iterate_bitmap(function, current());
+  if (is_dirty_current()) {
+    iterate_bitmap(function, current());
+  }
 }
 
 #endif // SHARE_GC_Z_ZREMEMBEREDSET_INLINE_HPP
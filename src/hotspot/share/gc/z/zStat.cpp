@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -941,6 +941,7 @@ volatile size_t ZStatMutatorAllocRate::_allocated_since_sample;
 TruncatedSeq    ZStatMutatorAllocRate::_samples_time(100);
 TruncatedSeq    ZStatMutatorAllocRate::_samples_bytes(100);
 TruncatedSeq    ZStatMutatorAllocRate::_rate(100);
+double          ZStatMutatorAllocRate::_burst_rate;
 
 void ZStatMutatorAllocRate::initialize() {
   _last_sample_time = os::elapsed_counter();
@@ -954,6 +955,10 @@ void ZStatMutatorAllocRate::update_sampling_granule() {
   _sampling_granule = align_up(soft_max_capacity / sampling_heap_granules, ZGranuleSize);
 }
 
+double ZStatMutatorAllocRate::decayed_burst_rate(double elapsed_seconds) {
+  return _burst_rate * pow(0.5, elapsed_seconds / BurstRateHalfLife);
+}
+
 void ZStatMutatorAllocRate::sample_allocation(size_t allocation_bytes) {
   const size_t allocated = Atomic::add(&_allocated_since_sample, allocation_bytes);
 
@@ -996,15 +1001,24 @@ void ZStatMutatorAllocRate::sample_allocation(size_t allocation_bytes) {
   const double bytes_per_second = double(last_sample_bytes) / elapsed_seconds;
   _rate.add(bytes_per_second);
 
+  // The rate above is averaged over the sample window, which smooths out
+  // short allocation bursts. Track the peak rate of individual samples,
+  // decaying over time, so that recurring bursts are remembered between
+  // their occurrences.
+  const double sample_seconds = double(elapsed) / os::elapsed_frequency();
+  const double sample_bytes_per_second = double(allocated_sample) / sample_seconds;
+  _burst_rate = MAX2(sample_bytes_per_second, decayed_burst_rate(sample_seconds));
+
   update_sampling_granule();
 
   _last_sample_time = now;
 
-  log_debug(gc, alloc)("Mutator Allocation Rate: %.1fMB/s Predicted: %.1fMB/s, Avg: %.1f(+/-%.1f)MB/s",
+  log_debug(gc, alloc)("Mutator Allocation Rate: %.1fMB/s Predicted: %.1fMB/s, Avg: %.1f(+/-%.1f)MB/s, Burst: %.1fMB/s",
                        bytes_per_second / M,
                        _rate.predict_next() / M,
                        _rate.avg() / M,
-                       _rate.sd() / M);
+                       _rate.sd() / M,
+                       _burst_rate / M);
 
   _stat_lock->unlock();
 
@@ -1013,7 +1027,8 @@ void ZStatMutatorAllocRate::sample_allocation(size_t allocation_bytes) {
 
 ZStatMutatorAllocRateStats ZStatMutatorAllocRate::stats() {
   ZLocker<ZLock> locker(_stat_lock);
-  return {_rate.avg(), _rate.predict_next(), _rate.sd()};
+  const double seconds_since_sample = double(os::elapsed_counter() - _last_sample_time) / os::elapsed_frequency();
+  return {_rate.avg(), _rate.predict_next(), _rate.sd(), decayed_burst_rate(MAX2(seconds_since_sample, 0.0))};
 }
 
 //
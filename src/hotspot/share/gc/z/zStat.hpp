@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -353,6 +353,7 @@ struct ZStatMutatorAllocRateStats {
   double _avg;
   double _predict;
   double _sd;
+  double _burst;
 };
 
 //
@@ -367,8 +368,13 @@ class ZStatMutatorAllocRate : public AllStatic {
   static TruncatedSeq    _samples_time;
   static TruncatedSeq    _samples_bytes;
   static TruncatedSeq    _rate;
+  static double          _burst_rate;
+
+  // Time for the burst allocation rate to decay to half its value
+  static constexpr double BurstRateHalfLife = 10.0; // seconds
 
   static void update_sampling_granule();
+  static double decayed_burst_rate(double elapsed_seconds);
 
 public:
   static const ZStatUnsampledCounter& counter();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,9 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ticks.hpp"
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
 
 #include <cmath>
 
@@ -50,17 +53,66 @@ ZUncommitter::ZUncommitter(uint32_t id, ZPartition* partition)
     _next_uncommit_timeout(0),
     _cycle_start(0.0),
     _to_uncommit(0),
-    _uncommitted(0) {
+    _uncommitted(0),
+    _is_under_memory_pressure(false) {
   set_name("ZUncommitter#%u", id);
   create_and_start();
 }
 
+static double memory_pressure() {
+#ifdef LINUX
+  if (OSContainer::is_containerized()) {
+    return OSContainer::memory_pressure();
+  }
+#endif
+
+  // Not available
+  return -1.0;
+}
+
+bool ZUncommitter::update_memory_pressure() const {
+  const double pressure = memory_pressure();
+  if (pressure < 0.0) {
+    // Not available
+    return false;
+  }
+
+  const bool is_under_memory_pressure = pressure >= MemoryPressureThreshold;
+
+  if (is_under_memory_pressure != _is_under_memory_pressure) {
+    log_info(gc, heap)("Uncommitter (%u) Memory Pressure %s: %.1f%%",
+                       _id, is_under_memory_pressure ? "High" : "Normal", pressure);
+    _is_under_memory_pressure = is_under_memory_pressure;
+  }
+
+  return true;
+}
+
+double ZUncommitter::uncommit_delay() const {
+  // When the container is under memory pressure, memory which has been
+  // unused since the last uncommit cycle is given back after the poll
+  // interval instead, so that it is available to others before the
+  // container runs out of memory.
+  if (_is_under_memory_pressure) {
+    return MIN2(double(ZUncommitDelay), double(MemoryPressurePollInterval) / MILLIUNITS);
+  }
+
+  return double(ZUncommitDelay);
+}
+
 bool ZUncommitter::wait(uint64_t timeout) const {
   ZLocker<ZConditionLock> locker(&_lock);
   while (!ZUncommit && !_stop) {
     _lock.wait();
   }
 
+  // Only poll the memory pressure when it is available
+  const bool poll_memory_pressure = update_memory_pressure();
+  if (_is_under_memory_pressure) {
+    // Already under memory pressure, wait at most the poll interval
+    timeout = MIN2(timeout, MemoryPressurePollInterval);
+  }
+
   if (!_stop && timeout > 0) {
     if (!uncommit_cycle_is_finished()) {
       log_trace(gc, heap)("Uncommitter (%u) Timeout: " UINT64_FORMAT "ms left to uncommit: "
@@ -79,7 +131,12 @@ bool ZUncommitter::wait(uint64_t timeout) const {
       }
 
       // Wait
-      _lock.wait(remaining_timeout_ms);
+      _lock.wait(poll_memory_pressure ? MIN2(remaining_timeout_ms, MemoryPressurePollInterval) : remaining_timeout_ms);
+
+      if (poll_memory_pressure && update_memory_pressure() && _is_under_memory_pressure) {
+        // Stop waiting and uncommit now
+        break;
+      }
 
       now = os::elapsedTime();
     } while (!_stop && now < wait_until);
@@ -249,9 +306,10 @@ uint64_t ZUncommitter::to_millis(double seconds) const {
 
 void ZUncommitter::update_next_cycle_timeout(double from_time) {
   const double now = os::elapsedTime();
+  const double delay = uncommit_delay();
 
-  if (now < from_time + double(ZUncommitDelay)) {
-    _next_cycle_timeout = to_millis(ZUncommitDelay) - to_millis(now - from_time);
+  if (now < from_time + delay) {
+    _next_cycle_timeout = to_millis(delay) - to_millis(now - from_time);
   } else {
     // ZUncommitDelay has already expired
     _next_cycle_timeout = 0;
@@ -319,7 +377,7 @@ void ZUncommitter::register_uncommit(size_t size) {
 
   const double uncommit_rate = double(_uncommitted) / time_since_start;
   const double time_to_complete = double(_to_uncommit) / uncommit_rate;
-  const double time_left = double(ZUncommitDelay) - time_since_start;
+  const double time_left = uncommit_delay() - time_since_start;
 
   if (time_left < time_to_complete) {
     // Too slow, work as fast as we can.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,11 @@ class ZPartition;
 
 class ZUncommitter : public ZThread {
 private:
+  // Memory stall percentage (over the last 10 seconds) of the container at
+  // which uncommitting starts without waiting for ZUncommitDelay to expire
+  static constexpr double MemoryPressureThreshold = 10.0;
+  static const uint64_t   MemoryPressurePollInterval = 1000; // ms
+
   const uint32_t         _id;
   ZPartition* const      _partition;
   mutable ZConditionLock _lock;
@@ -42,6 +47,11 @@ class ZUncommitter : public ZThread {
   double                 _cycle_start;
   size_t                 _to_uncommit;
   size_t                 _uncommitted;
+  mutable bool           _is_under_memory_pressure;
+
+  // Returns false if the memory pressure is not available
+  bool update_memory_pressure() const;
+  double uncommit_delay() const;
 
   bool wait(uint64_t timeout) const;
   bool should_continue() const;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -266,6 +266,10 @@ class Bytecodes: AllStatic {
     _fast_lputfield       ,
     _fast_sputfield       ,
 
+    // Fused pairs, rewritten by the templates of the first bytecode when
+    // RewriteFrequentPairs is set: aload_0 followed by a getfield of an
+    // int, object or float field, iload followed by iload, and iload
+    // followed by caload. Any new pair needs templates on all platforms.
     _fast_aload_0         ,
     _fast_iaccess_0       ,
     _fast_aaccess_0       ,
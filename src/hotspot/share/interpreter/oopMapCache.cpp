@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -429,7 +429,14 @@ void InterpreterOopMap::copy_from(const OopMapCacheEntry* src) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
+  // Methods of the same class often agree on all of the shape values below, so
+  // the Method* address is mixed in as well to spread them over the table.
+  // Metaspace objects are word aligned, so the low bits carry no information.
+  // The result is used as a non-negative int probe, so keep it below 2^31.
+  const uintptr_t addr = (uintptr_t) method();
+  const unsigned int addr_bits = (unsigned int) (((addr >> LogBytesPerWord) ^ (addr >> (LogBytesPerWord + 5))) & 0xFFFFF);
   return   ((unsigned int) bci)
+         ^ addr_bits
          ^ ((unsigned int) method->max_locals()         << 2)
          ^ ((unsigned int) method->code_size()          << 4)
          ^ ((unsigned int) method->size_of_parameters() << 6);
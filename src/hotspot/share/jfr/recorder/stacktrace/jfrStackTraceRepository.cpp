@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 
 /*
@@ -51,7 +52,7 @@ JfrStackTraceRepository& JfrStackTraceRepository::leak_profiler_instance() {
   return *_leak_profiler_instance;
 }
 
-JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0) {
+JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0), _generation(0) {
   memset(_table, 0, sizeof(_table));
 }
 
@@ -116,6 +117,7 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (clear) {
     memset(_table, 0, sizeof(_table));
     _entries = 0;
+    Atomic::inc(&_generation);
   }
   _last_entries = _entries;
   return count;
@@ -135,6 +137,7 @@ size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
     }
   }
   memset(repo._table, 0, sizeof(repo._table));
+  Atomic::inc(&repo._generation);
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -156,16 +159,49 @@ traceid JfrStackTraceRepository::record(Thread* current_thread, int skip /* 0 */
   return stacktrace.record(JavaThread::cast(current_thread), skip, stack_filter_id) ? add(instance(), stacktrace) : 0;
 }
 
+// With JfrThreadLocalStackTraceCache, each thread keeps a copy of the last
+// stack trace it added to the primary repository. Threads tend to record the
+// same stack repeatedly, e.g. for allocation samples in a loop, and a hit
+// avoids taking JfrStacktrace_lock. The copy is only valid for the repository
+// generation it was added in, since clearing the table drops the entry and
+// the trace would then not be written for the next chunk.
+static JfrThreadLocal* thread_local_cache(const JfrStackTraceRepository* repo) {
+  if (!JfrThreadLocalStackTraceCache || repo != _instance) {
+    return nullptr;
+  }
+  Thread* const thread = Thread::current_or_null();
+  return thread != nullptr ? thread->jfr_thread_local() : nullptr;
+}
+
 traceid JfrStackTraceRepository::add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace) {
+  JfrThreadLocal* const tl = thread_local_cache(&repo);
+  // Read the generation before adding, so a concurrent clear invalidates the copy.
+  const u4 generation = Atomic::load_acquire(&repo._generation);
+  if (tl != nullptr) {
+    const JfrStackTrace* const last = tl->last_stack_trace();
+    if (last != nullptr && tl->last_stack_trace_generation() == generation && last->equals(stacktrace)) {
+      return last->id();
+    }
+  }
   traceid tid = repo.add_trace(stacktrace);
   if (tid == 0) {
     stacktrace.resolve_linenos();
     tid = repo.add_trace(stacktrace);
   }
   assert(tid != 0, "invariant");
+  if (tl != nullptr) {
+    delete tl->last_stack_trace();
+    tl->set_last_stack_trace(new JfrStackTrace(tid, stacktrace, nullptr), generation);
+  }
   return tid;
 }
 
+void JfrStackTraceRepository::release_thread_local_cache(JfrThreadLocal* tl) {
+  assert(tl != nullptr, "invariant");
+  delete tl->last_stack_trace();
+  tl->set_last_stack_trace(nullptr, 0);
+}
+
 traceid JfrStackTraceRepository::add(const JfrStackTrace& stacktrace) {
   return add(instance(), stacktrace);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 class JavaThread;
 class JfrChunkWriter;
 class JfrStackTrace;
+class JfrThreadLocal;
 
 class JfrStackTraceRepository : public JfrCHeapObj {
   friend class JfrDeprecatedEdge;
@@ -50,6 +51,9 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   JfrStackTrace* _table[TABLE_SIZE];
   u4 _last_entries;
   u4 _entries;
+  // Incremented whenever the table is cleared, invalidating the
+  // per-thread last stack trace caches (JfrThreadLocalStackTraceCache).
+  volatile u4 _generation;
 
   JfrStackTraceRepository();
   static JfrStackTraceRepository& instance();
@@ -76,6 +80,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
  public:
   static traceid add(const JfrStackTrace& stacktrace);
   static traceid record(Thread* current_thread, int skip = 0, int64_t stack_filter_id = -1);
+  static void release_thread_local_cache(JfrThreadLocal* tl);
 };
 
 #endif // SHARE_JFR_RECORDER_STACKTRACE_JFRSTACKTRACEREPOSITORY_HPP
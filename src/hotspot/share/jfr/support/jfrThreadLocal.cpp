@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,8 @@ JfrThreadLocal::JfrThreadLocal() :
   _data_lost(0),
   _stack_trace_id(max_julong),
   _stack_trace_hash(0),
+  _last_stack_trace(nullptr),
+  _last_stack_trace_generation(0),
   _parent_trace_id(0),
   _last_allocated_bytes(0),
   _user_time(0),
@@ -200,6 +202,9 @@ void JfrThreadLocal::release(Thread* t) {
     delete _dcmd_arena;
     _dcmd_arena = nullptr;
   }
+  if (_last_stack_trace != nullptr) {
+    JfrStackTraceRepository::release_thread_local_cache(this);
+  }
 }
 
 void JfrThreadLocal::release(JfrThreadLocal* tl, Thread* t) {
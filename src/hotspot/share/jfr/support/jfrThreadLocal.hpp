@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@
 class Arena;
 class JavaThread;
 class JfrBuffer;
+class JfrStackTrace;
 class Thread;
 
 class JfrThreadLocal {
@@ -68,6 +69,8 @@ class JfrThreadLocal {
   u8 _data_lost;
   traceid _stack_trace_id;
   traceid _stack_trace_hash;
+  const JfrStackTrace* _last_stack_trace;
+  u4 _last_stack_trace_generation;
   traceid _parent_trace_id;
   int64_t _last_allocated_bytes;
   jlong _user_time;
@@ -298,6 +301,20 @@ class JfrThreadLocal {
     return _stack_trace_hash;
   }
 
+  // Last stack trace added to the repository, see JfrThreadLocalStackTraceCache.
+  const JfrStackTrace* last_stack_trace() const {
+    return _last_stack_trace;
+  }
+
+  u4 last_stack_trace_generation() const {
+    return _last_stack_trace_generation;
+  }
+
+  void set_last_stack_trace(const JfrStackTrace* stacktrace, u4 generation) {
+    _last_stack_trace = stacktrace;
+    _last_stack_trace_generation = generation;
+  }
+
   u8 data_lost() const {
     return _data_lost;
   }
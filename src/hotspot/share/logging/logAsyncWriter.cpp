@@ -1,6 +1,6 @@
 /*
  * Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -112,8 +112,12 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
   {
     ConsumerLocker clocker;
     if (_buffer->push_back(output, decorations, msg, msg_len)) {
-      _data_available = true;
-      clocker.notify();
+      // The consumer only waits while no data is available, so only the
+      // first message after a buffer swap needs to wake it up.
+      if (!_data_available) {
+        _data_available = true;
+        clocker.notify();
+      }
       return;
     }
 
@@ -47,14 +47,14 @@ char* AllocateHeap(size_t size,
 char* AllocateHeap(size_t size,
                    MemTag mem_tag,
                    AllocFailType alloc_failmode /* = AllocFailStrategy::EXIT_OOM*/) {
-  return AllocateHeap(size, mem_tag, CALLER_PC, alloc_failmode);
+  return AllocateHeap(size, mem_tag, MALLOC_CALLER_PC, alloc_failmode);
 }
 
 char* ReallocateHeap(char *old,
                      size_t size,
                      MemTag mem_tag,
                      AllocFailType alloc_failmode) {
-  char* p = (char*) os::realloc(old, size, mem_tag, CALLER_PC);
+  char* p = (char*) os::realloc(old, size, mem_tag, MALLOC_CALLER_PC);
   if (p == nullptr && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
     vm_exit_out_of_memory(size, OOM_MALLOC_ERROR, "ReallocateHeap");
   }
@@ -87,7 +87,7 @@ void* MetaspaceObj::operator new(size_t size, ClassLoaderData* loader_data,
 
 // This is used for allocating training data. We are allocating training data in many cases where a GC cannot be triggered.
 void* MetaspaceObj::operator new(size_t size, MemTag flags) {
-  void* p = AllocateHeap(size, flags, CALLER_PC);
+  void* p = AllocateHeap(size, flags, MALLOC_CALLER_PC);
   memset(p, 0, size);
   return p;
 }
@@ -125,7 +125,7 @@ void* AnyObj::operator new(size_t size, Arena *arena) {
 }
 
 void* AnyObj::operator new(size_t size, MemTag mem_tag) throw() {
-  address res = (address)AllocateHeap(size, mem_tag, CALLER_PC);
+  address res = (address)AllocateHeap(size, mem_tag, MALLOC_CALLER_PC);
   DEBUG_ONLY(set_allocation_type(res, C_HEAP);)
   return res;
 }
@@ -133,7 +133,7 @@ void* AnyObj::operator new(size_t size, MemTag mem_tag) throw() {
 void* AnyObj::operator new(size_t size, const std::nothrow_t&  nothrow_constant,
     MemTag mem_tag) throw() {
   // should only call this with std::nothrow, use other operator new() otherwise
-    address res = (address)AllocateHeap(size, mem_tag, CALLER_PC, AllocFailStrategy::RETURN_NULL);
+    address res = (address)AllocateHeap(size, mem_tag, MALLOC_CALLER_PC, AllocFailStrategy::RETURN_NULL);
     DEBUG_ONLY(if (res!= nullptr) set_allocation_type(res, C_HEAP);)
   return res;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,7 @@ CodeHeap::CodeHeap(const char* name, const CodeBlobType code_blob_type)
   _last_insert_point            = nullptr;
   _freelist_segments            = 0;
   _freelist_length              = 0;
+  _freelist_max_length          = 0;
   _max_allocated_capacity       = 0;
   _blob_count                   = 0;
   _nmethod_count                = 0;
@@ -573,6 +574,7 @@ bool CodeHeap::merge_right(FreeBlock* a) {
     // Merge block a to include the following block.
     a->set_length(a->length() + a->link()->length());
     a->set_link(a->link()->link());
+    _freelist_max_length = MAX2(_freelist_max_length, a->length());
 
     // Update the segment map and invalidate block contents.
     mark_segmap_as_used(follower, segment_for(a) + a->length(), true);
@@ -600,6 +602,7 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
 
   // Mark as free and update free space count
   _freelist_segments += b->length();
+  _freelist_max_length = MAX2(_freelist_max_length, b->length());
   b->set_free();
   invalidate(bseg, bseg + b->length(), sizeof(FreeBlock));
 
@@ -657,9 +660,18 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
 
   length = length < CodeCacheMinBlockLength ? CodeCacheMinBlockLength : length;
 
-  // Search for best-fitting block
+  // Nothing to find if no block is large enough. This avoids walking a long
+  // freelist of small fragments when the request has to be served from the
+  // unused end of the heap anyway.
+  if (length > _freelist_max_length) {
+    return nullptr;
+  }
+
+  // Search for best-fitting block, remembering the largest block seen
+  size_t max_length = 0;
   while(cur != nullptr) {
     size_t cur_length = cur->length();
+    max_length = MAX2(max_length, cur_length);
     if (cur_length == length) {
       // We have a perfect fit
       found_block  = cur;
@@ -678,9 +690,15 @@ HeapBlock* CodeHeap::search_freelist(size_t length) {
   }
 
   if (found_block == nullptr) {
-    // None found
+    // None found. The whole freelist was scanned, so the bound is now exact.
+    _freelist_max_length = max_length;
     return nullptr;
   }
+  if (cur == nullptr) {
+    // The whole freelist was scanned without a perfect fit. Blocks only shrink
+    // by the allocation below, so the largest length seen remains a bound.
+    _freelist_max_length = max_length;
+  }
 
   // Exact (or at least good enough) fit. Remove from list.
   // Don't leave anything on the freelist smaller than CodeCacheMinBlockLength.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2018, 2023 SAP SE. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -62,7 +62,8 @@ void ChunkManager::return_chunk_simple_locked(Metachunk* c) {
 ChunkManager::ChunkManager(const char* name, VirtualSpaceList* space_list) :
   _vslist(space_list),
   _name(name),
-  _chunks()
+  _chunks(),
+  _purged_words(0)
 {
 }
 
@@ -355,6 +356,9 @@ void ChunkManager::purge() {
 
   const size_t reserved_after = _vslist->reserved_words();
   const size_t committed_after = _vslist->committed_words();
+  if (committed_before > committed_after) {
+    _purged_words += committed_before - committed_after;
+  }
 
   // Print a nice report.
   if (reserved_after == reserved_before && committed_after == committed_before) {
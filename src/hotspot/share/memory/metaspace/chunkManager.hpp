@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2018, 2022 SAP SE. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -81,6 +81,9 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   // Freelists
   FreeChunkListVector _chunks;
 
+  // Total number of words uncommitted by purge() over the lifetime of this manager.
+  size_t _purged_words;
+
   // Returns true if this manager contains the given chunk. Slow (walks free lists) and
   // only needed for verifications.
   DEBUG_ONLY(bool contains_chunk(Metachunk* c) const;)
@@ -166,6 +169,9 @@ class ChunkManager : public CHeapObj<mtMetaspace> {
   // Calculates the total number of committed words over all chunks. Walks chunks.
   size_t calc_committed_word_size() const;
 
+  // Returns the total number of words returned to the OS by purge() so far.
+  size_t purged_word_size() const           { return _purged_words; }
+
   // Update statistics.
   void add_to_statistics(ChunkManagerStats* out) const;
 
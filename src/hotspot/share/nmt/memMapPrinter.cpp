@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2023, 2024, Red Hat, Inc. and/or its affiliates.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -267,6 +267,27 @@ bool MappingPrintSession::print_nmt_info_for_region(const void* vma_from, const
   return num_printed > 0;
 }
 
+MemTag MappingPrintSession::single_mem_tag_for_region(const void* vma_from, const void* vma_to) const {
+  MemTag result = mtNone;
+  if (MemTracker::enabled()) {
+    const MemTagBitmap flags = _nmt_info.lookup(vma_from, vma_to);
+    for (int i = 0; i < mt_number_of_tags; i++) {
+      const MemTag mem_tag = (MemTag)i;
+      if (flags.has_tag(mem_tag)) {
+        if (result != mtNone) {
+          return mtNone;
+        }
+        result = mem_tag;
+      }
+    }
+  }
+  return result;
+}
+
+const char* MappingPrintSession::mem_tag_shortname(MemTag mem_tag) {
+  return get_shortname_for_mem_tag(mem_tag);
+}
+
 void MemMapPrinter::print_all_mappings(outputStream* st) {
   CachedNMTInformation nmt_info;
   st->print_cr("Memory mappings:");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2023, 2024, Red Hat, Inc. and/or its affiliates.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -41,6 +41,9 @@ class MappingPrintSession {
 public:
   MappingPrintSession(outputStream* st, const CachedNMTInformation& nmt_info);
   bool print_nmt_info_for_region(const void* from, const void* to) const;
+  // Returns the single NMT tag covering the region, or mtNone if it has none or several.
+  MemTag single_mem_tag_for_region(const void* from, const void* to) const;
+  static const char* mem_tag_shortname(MemTag mem_tag);
   void print_nmt_flag_legend() const;
   outputStream* out() const { return _out; }
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -310,6 +310,10 @@ void MemDetailReporter::report_detail() {
   // Start detail report
   outputStream* out = output();
   out->print_cr("Details:\n");
+  if (NMTDetailStackSampleInterval > 1) {
+    out->print_cr("(Malloc call stacks sampled for one in %u allocations; malloc call site amounts are a sample.)\n",
+                  NMTDetailStackSampleInterval);
+  }
 
   int num_omitted =
       report_malloc_sites() +
@@ -337,7 +341,11 @@ int MemDetailReporter::report_malloc_sites() {
       continue;
     }
     const NativeCallStack* stack = malloc_site->call_stack();
-    _stackprinter.print_stack(stack);
+    if (stack->is_empty()) {
+      out->print_cr("[no call stack]");
+    } else {
+      _stackprinter.print_stack(stack);
+    }
     MemTag mem_tag = malloc_site->mem_tag();
     assert(NMTUtil::tag_is_valid(mem_tag) && mem_tag != mtNone,
       "Must have a valid memory tag");
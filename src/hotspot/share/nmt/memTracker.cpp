@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2020, 2023 SAP SE. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -52,6 +52,8 @@ NMT_TrackingLevel MemTracker::_tracking_level = NMT_unknown;
 
 Deferred<MemBaseline> MemTracker::_baseline;
 
+THREAD_LOCAL uint MemTracker::_stack_sample_counter = 0;
+
 bool MemTracker::NmtVirtualMemoryLocker::_safe_to_use;
 
 void MemTracker::initialize() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 #include "nmt/memoryFileTracker.hpp"
 #include "nmt/threadStackTracker.hpp"
 #include "nmt/virtualMemoryTracker.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/nativeCallStack.hpp"
@@ -42,6 +43,13 @@
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
 
+// Like CALLER_PC, but subject to NMTDetailStackSampleInterval. Only used on
+// the malloc path; virtual memory and thread stack records always carry
+// their call stack.
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail) ?    \
+                          (MemTracker::sample_stack() ? NativeCallStack(1) : \
+                           NativeCallStack::empty_stack()) : FAKE_CALLSTACK)
+
 class MemTracker : AllStatic {
   friend class VirtualMemoryTrackerTest;
 
@@ -76,6 +84,17 @@ class MemTracker : AllStatic {
     return _tracking_level > NMT_off;
   }
 
+  // In detail mode, returns true if the native call stack should be captured
+  // for the current malloc. With NMTDetailStackSampleInterval > 1 only one
+  // in that many mallocs per thread walks the stack; the others are
+  // accounted to the empty call stack.
+  static inline bool sample_stack() {
+    if (NMTDetailStackSampleInterval <= 1) {
+      return true;
+    }
+    return (++_stack_sample_counter % NMTDetailStackSampleInterval) == 0;
+  }
+
   // Per-malloc overhead incurred by NMT, depending on the current NMT level
   static size_t overhead_per_malloc() {
     return enabled() ? MallocTracker::overhead_per_malloc() : 0;
@@ -320,6 +339,8 @@ class MemTracker : AllStatic {
   static NMT_TrackingLevel   _tracking_level;
   // Stored baseline
   static Deferred<MemBaseline>      _baseline;
+  // Per-thread allocation counter for call stack sampling
+  static THREAD_LOCAL uint          _stack_sample_counter;
 };
 
 #endif // SHARE_NMT_MEMTRACKER_HPP
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2000, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1702,6 +1702,21 @@ bool MethodData::profile_unsafe(const methodHandle& m, int bci) {
   return false;
 }
 
+// Stream operations are usually megamorphic in the lambdas passed to them.
+// Profiling the arguments at the call sites of the operations allows C2 to
+// speculate on the exact lambda types in the inlined pipeline code, which
+// turns the calls of the lambdas into monomorphic calls.
+bool MethodData::profile_stream(const methodHandle& m, int bci) {
+  if (!ProfileStreamArguments) {
+    return false;
+  }
+  Bytecode_invoke inv(m , bci);
+  if (inv.is_invokeinterface() || inv.is_invokevirtual()) {
+    return inv.klass()->starts_with("java/util/stream/");
+  }
+  return false;
+}
+
 int MethodData::profile_arguments_flag() {
   return TypeProfileLevel % 10;
 }
@@ -1727,7 +1742,7 @@ bool MethodData::profile_arguments_for_invoke(const methodHandle& m, int bci) {
     return true;
   }
 
-  if (profile_unsafe(m, bci)) {
+  if (profile_unsafe(m, bci) || profile_stream(m, bci)) {
     return true;
   }
 
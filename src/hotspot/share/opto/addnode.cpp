@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #include "opto/cfgnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/machnode.hpp"
+#include "opto/memnode.hpp"
 #include "opto/movenode.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/phaseX.hpp"
@@ -830,6 +831,13 @@ Node* OrINode::Ideal(PhaseGVN* phase, bool can_reshape) {
     Node* tn = phase->transform(and_a_b);
     return AddNode::make_not(phase, tn, T_INT);
   }
+  if (MergeLoads && UseUnalignedAccesses) {
+    Node* progress = LoadNode::merge_primitive_loads(phase, this);
+    if (progress != nullptr) {
+      return progress;
+    }
+  }
+
   return AddNode::Ideal(phase, can_reshape);
 }
 
@@ -910,6 +918,13 @@ Node* OrLNode::Ideal(PhaseGVN* phase, bool can_reshape) {
     return AddNode::make_not(phase, tn, T_LONG);
   }
 
+  if (MergeLoads && UseUnalignedAccesses) {
+    Node* progress = LoadNode::merge_primitive_loads(phase, this);
+    if (progress != nullptr) {
+      return progress;
+    }
+  }
+
   return AddNode::Ideal(phase, can_reshape);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1762,6 +1762,10 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
       // Append traces, even without a fall-thru connection.
       // But leave root entry at the beginning of the block list.
       if (targ_trace != trace(_cfg.get_root_block())) {
+        if (BlockLayoutMoveColdTraces && is_cold(targ_trace) && !is_cold(src_trace)) {
+          // Keep the cold trace out of the hot code, see reorder_traces.
+          continue;
+        }
         e->set_state(CFGEdge::connected);
         src_trace->append(targ_trace);
         union_traces(src_trace, targ_trace);
@@ -1770,6 +1774,10 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
   }
 }
 
+bool PhaseBlockLayout::is_cold(Trace* tr) const {
+  return _cfg.is_uncommon(tr->first_block());
+}
+
 // Order the sequence of the traces in some desirable way
 void PhaseBlockLayout::reorder_traces(int count) {
   Trace** new_traces = NEW_RESOURCE_ARRAY(Trace*, count);
@@ -1791,6 +1799,30 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  if (BlockLayoutMoveColdTraces) {
+    // Move the cold traces after all others, so that the slow paths do not
+    // spread out the hot code. The frequency order is kept otherwise.
+    Trace** hot_traces = NEW_RESOURCE_ARRAY(Trace*, new_count);
+    Trace** cold_traces = NEW_RESOURCE_ARRAY(Trace*, new_count);
+    int hot_count = 0;
+    int cold_count = 0;
+    for (int i = 0; i < new_count; i++) {
+      Trace* tr = new_traces[i];
+      bool is_connector = tr->first_block()->is_connector();
+      if (i > 0 && (is_connector || is_cold(tr))) {
+        cold_traces[cold_count++] = tr;
+      } else {
+        hot_traces[hot_count++] = tr;
+      }
+    }
+    // Add the cold traces in frequency order, except for the trace of
+    // connector blocks which stays at the end.
+    for (int i = 0; i < cold_count; i++) {
+      hot_traces[hot_count + i] = cold_traces[i];
+    }
+    new_traces = hot_traces;
+  }
+
   // Collect all blocks from existing Traces
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -180,6 +180,13 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
       return false;
     }
   }
+  if (size > max_inline_size &&
+      max_inline_size > default_max_inline_size &&
+      UseInliningBenefitHeuristic &&
+      is_beneficial_hot_method(callee_method, caller_jvms, size, freq)) {
+    set_msg("hot method with inlining benefit");
+    return true;
+  }
   if (size > max_inline_size) {
     if (max_inline_size > default_max_inline_size) {
       set_msg("hot method too big");
@@ -191,6 +198,48 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
   return true;
 }
 
+// Count the arguments at the call site that allow the inlined callee to be
+// specialized: constants, and objects with an exact type.
+int InlineTree::count_specialized_arguments(ciMethod* callee_method, JVMState* caller_jvms) {
+  SafePointNode* map = caller_jvms->map();
+  if (map == nullptr) {
+    return 0;
+  }
+  int count = 0;
+  for (int i = 0; i < callee_method->arg_size(); i++) {
+    if (caller_jvms->argoff() + i >= map->req()) {
+      break;
+    }
+    const Type* t = map->argument(caller_jvms, i)->bottom_type();
+    if (t == Type::TOP) {
+      continue;
+    }
+    const TypeInstPtr* inst_t = t->isa_instptr();
+    if (t->singleton() || (inst_t != nullptr && inst_t->klass_is_exact())) {
+      count++;
+    }
+  }
+  return count;
+}
+
+// A hot method larger than FreqInlineSize may still be worth inlining. The
+// benefit grows with the frequency of the call site, and with the number of
+// arguments the callee can be specialized for. The cost is the bytecode size
+// of the callee, which must also leave room for other call sites in the
+// inlining budget of the compilation.
+bool InlineTree::is_beneficial_hot_method(ciMethod* callee_method, JVMState* caller_jvms,
+                                          int size, double freq) const {
+  const double max_factor = 4.0;
+  const double freq_factor = InlineFrequencyRatio > 0.0 ? MIN2(freq / InlineFrequencyRatio, max_factor)
+                                                        : max_factor;
+  const int specialized_args = count_specialized_arguments(callee_method, caller_jvms);
+  const double benefit = MIN2(freq_factor * (1 + specialized_args), max_factor);
+  if (size > benefit * C->freq_inline_size()) {
+    return false;
+  }
+  const int remaining_budget = DesiredMethodLimit - (int)count_inline_bcs();
+  return size <= remaining_budget / 4;
+}
 
 // negative filter: should callee NOT be inlined?
 bool InlineTree::should_not_inline(ciMethod* callee_method, ciMethod* caller_method,
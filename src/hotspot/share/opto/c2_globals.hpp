@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2000, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -285,6 +285,10 @@
           "Spill selection in reg allocator: scale area by (X/64K) before " \
           "adding cost")                                                    \
                                                                             \
+  product(bool, ScaleVectorSpillCost, false, EXPERIMENTAL,                  \
+          "Spill selection in reg allocator: scale the spill cost of wide " \
+          "vectors that cannot be rematerialized by their size")            \
+                                                                            \
   develop_pd(bool, UseCISCSpill,                                            \
           "Use ADLC supplied cisc instructions during allocation")          \
                                                                             \
@@ -352,6 +356,16 @@
   develop(bool, TraceLoopMultiversioning, false,                            \
           "Trace loop multiversioning")                                     \
                                                                             \
+  product(uintx, LogCompilePhaseTimesAboveMillis, 0, DIAGNOSTIC,            \
+          "Log the time spent in each phase of C2 compilations that take "  \
+          "longer than this many milliseconds with -Xlog:jit+compilation. " \
+          "0 disables it.")                                                 \
+                                                                            \
+  product(bool, UseAutoVectorizationSpeculativeAliasingChecks, false,       \
+          EXPERIMENTAL,                                                     \
+          "Allow auto vectorization of memory accesses that may alias, "    \
+          "guarded by a runtime check that they do not overlap")            \
+                                                                            \
   product(bool, AllowVectorizeOnDemand, true,                               \
           "Globally suppress vectorization set in VectorizeMethod")         \
                                                                             \
@@ -399,6 +413,10 @@
   product(bool, MergeStores, true, DIAGNOSTIC,                              \
           "Optimize stores by combining values into larger store")          \
                                                                             \
+  product(bool, MergeLoads, false, EXPERIMENTAL,                            \
+          "Optimize adjacent byte loads combined with shifts and ors into " \
+          "a larger load")                                                  \
+                                                                            \
   product_pd(bool, OptoBundling,                                            \
           "Generate nops to fill i-cache lines")                            \
                                                                             \
@@ -445,6 +463,17 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(uint, PolymorphicInlineWidth, 0, EXPERIMENTAL,                    \
+          "Maximum number of profiled receivers to inline at a "            \
+          "megamorphic call site, guarded by a type switch. Requires "      \
+          "TypeProfileWidth to be at least as large. 0 disables it.")       \
+          range(0, 8)                                                       \
+                                                                            \
+  product(uint, PolymorphicInlineCoveragePercent, 99, EXPERIMENTAL,         \
+          "Minimum percentage of the calls at a megamorphic call site "     \
+          "that the inlined receivers must cover")                          \
+          range(0, 100)                                                     \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -525,6 +554,10 @@
   product(bool, ReduceAllocationMerges, true, DIAGNOSTIC,                   \
           "Try to simplify allocation merges before Scalar Replacement")    \
                                                                             \
+  product(bool, ReduceAllocationMergesInLoops, false, EXPERIMENTAL,         \
+          "Also simplify allocation merges at loop heads, if all merged "   \
+          "objects are scalar replaceable allocations")                     \
+                                                                            \
   develop(bool, TraceReduceAllocationMerges, false,                         \
              "Trace decision for simplifying allocation merges.")           \
                                                                             \
@@ -538,6 +571,13 @@
           "Abort EA when it reaches time limit (in sec)")                   \
           range(0, DBL_MAX)                                                 \
                                                                             \
+  product(double, ColdEscapePathTrapProbability, 0.0, EXPERIMENTAL,         \
+          "Replace a branch taken with a probability below this by an "     \
+          "uncommon trap if objects allocated in the compilation are live " \
+          "at the branch, so they do not escape on the rarely taken path "  \
+          "and may be scalar replaced. Specify 0 to disable.")              \
+          range(0.0, 0.1)                                                   \
+                                                                            \
   develop(bool, ExitEscapeAnalysisOnTimeout, true,                          \
           "Exit or throw assert in EA when it reaches time limit")          \
                                                                             \
@@ -596,6 +636,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(bool, BlockLayoutMoveColdTraces, false, EXPERIMENTAL,             \
+          "Place traces starting with an uncommon block after all other "   \
+          "traces in the frequency based block layout")                     \
+                                                                            \
   product(bool, InlineReflectionGetCallerClass, true, DIAGNOSTIC,           \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
@@ -732,6 +776,10 @@
           "The maximum bytecode size of a frequent method to be inlined")   \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, UseInliningBenefitHeuristic, false, EXPERIMENTAL,           \
+          "Inline hot methods larger than FreqInlineSize if the call site " \
+          "frequency and the specialized arguments outweigh their size")    \
+                                                                            \
   product(intx, MaxTrivialSize, 6,                                          \
           "The maximum bytecode size of a trivial method to be inlined by " \
           "high tier compiler")                                             \
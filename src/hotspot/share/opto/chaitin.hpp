@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -150,6 +150,17 @@ class LRG : public ResourceObj {
                                 // Meaningful only when _is_scalable is true.
 public:
   int num_regs() const { return _num_regs; }
+
+  // Spilling and reloading a wide vector moves more memory than a scalar. Scale
+  // the spill cost by the number of 128-bit parts, so that under high vector
+  // pressure, rematerializable vectors (e.g. broadcasts of constants) and narrow
+  // values are preferred as spill candidates.
+  double spill_cost_scale() const {
+    if (!ScaleVectorSpillCost || !_is_vector || _is_scalable) {
+      return 1.0;
+    }
+    return MAX2(1, _num_regs / (int)RegMask::SlotsPerVecX);
+  }
   void set_num_regs( int reg ) { assert( _num_regs == reg || !_num_regs, "" ); _num_regs = reg; }
 
   uint scalable_reg_slots() { return _scalable_reg_slots; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,6 +42,8 @@
 #include "gc/shared/c2/barrierSetC2.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm_io.h"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "memory/arena.hpp"
 #include "memory/resourceArea.hpp"
@@ -694,7 +696,8 @@ Compile::Compile(ciEnv* ci_env, ciMethod* target, int osr_bci,
       _java_calls(0),
       _inner_loops(0),
       _interpreter_frame_size(0),
-      _output(nullptr)
+      _output(nullptr),
+      _phase_counters(nullptr)
 #ifndef PRODUCT
       ,
       _in_dump_cnt(0)
@@ -705,6 +708,7 @@ Compile::Compile(ciEnv* ci_env, ciMethod* target, int osr_bci,
 
   TraceTime t1("Total compilation time", &_t_totalCompilation, CITime, CITimeVerbose);
   TraceTime t2(nullptr, &_t_methodCompilation, CITime, false);
+  PhaseTimesLogger ptl(this);
 
 #if defined(SUPPORT_ASSEMBLY) || defined(SUPPORT_ABSTRACT_ASSEMBLY)
   bool print_opto_assembly = directive->PrintOptoAssemblyOption;
@@ -965,6 +969,7 @@ Compile::Compile(ciEnv* ci_env,
       _inner_loops(0),
       _interpreter_frame_size(0),
       _output(nullptr),
+      _phase_counters(nullptr),
 #ifndef PRODUCT
       _in_dump_cnt(0),
 #endif
@@ -4412,7 +4417,9 @@ Compile::TracePhase::TracePhase(const char* name, PhaseTraceId id)
   : TraceTime(name, &Phase::timers[id], CITime, CITimeVerbose),
     _compile(Compile::current()),
     _log(nullptr),
-    _dolog(CITimeVerbose)
+    _dolog(CITimeVerbose),
+    _id(id),
+    _start_counter(_compile->_phase_counters != nullptr ? os::elapsed_counter() : 0)
 {
   assert(_compile != nullptr, "sanity check");
   assert(id != PhaseTraceId::_t_none, "Don't use none");
@@ -4435,6 +4442,9 @@ Compile::TracePhase::TracePhase(PhaseTraceId id)
   : TracePhase(Phase::get_phase_trace_id_text(id), id) {}
 
 Compile::TracePhase::~TracePhase() {
+  if (_compile->_phase_counters != nullptr) {
+    _compile->_phase_counters[_id] += os::elapsed_counter() - _start_counter;
+  }
 
   // Inform memory statistic, if enabled
   if (CompilationMemoryStatistic::enabled()) {
@@ -4463,6 +4473,45 @@ Compile::TracePhase::~TracePhase() {
   }
 }
 
+Compile::PhaseTimesLogger::PhaseTimesLogger(Compile* C)
+  : _compile(C),
+    _start_counter(os::elapsed_counter()) {
+  if (LogCompilePhaseTimesAboveMillis > 0 && log_is_enabled(Info, jit, compilation)) {
+    for (int i = 0; i < max_phase_timers; i++) {
+      _phase_counters[i] = 0;
+    }
+    _compile->_phase_counters = _phase_counters;
+  }
+}
+
+Compile::PhaseTimesLogger::~PhaseTimesLogger() {
+  if (_compile->_phase_counters == nullptr) {
+    return;
+  }
+  _compile->_phase_counters = nullptr;
+
+  const double counters_per_ms = (double)os::elapsed_frequency() / MILLIUNITS;
+  const double total_ms = (double)(os::elapsed_counter() - _start_counter) / counters_per_ms;
+  if (total_ms < (double)LogCompilePhaseTimesAboveMillis) {
+    return;
+  }
+
+  // Nested phases are included in the times of their enclosing phases.
+  LogTarget(Info, jit, compilation) lt;
+  LogStream ls(lt);
+  ls.print("C2 compilation %d of ", _compile->compile_id());
+  _compile->method()->print_short_name(&ls);
+  ls.print_cr(" took %.1f ms, %s, nodes: %u", total_ms,
+              _compile->failing() ? "failed" : "succeeded", _compile->unique());
+  for (int i = 0; i < max_phase_timers; i++) {
+    if (_phase_counters[i] == 0) {
+      continue;
+    }
+    ls.print_cr("  %-30s %10.1f ms", Phase::get_phase_trace_id_text((PhaseTraceId)i),
+                (double)_phase_counters[i] / counters_per_ms);
+  }
+}
+
 //----------------------------static_subtype_check-----------------------------
 // Shortcut important common cases when superklass is exact:
 // (0) superklass is java.lang.Object (can occur in reflective code)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -239,6 +239,8 @@ class Compile : public Phase {
     Compile* const _compile;
     CompileLog* _log;
     const bool _dolog;
+    const PhaseTraceId _id;
+    const jlong _start_counter;
    public:
     TracePhase(PhaseTraceId phaseTraceId);
     TracePhase(const char* name, PhaseTraceId phaseTraceId);
@@ -246,6 +248,19 @@ class Compile : public Phase {
     const char* phase_name() const { return title(); }
   };
 
+  // Records the time spent in each phase of this compilation, and logs it
+  // with -Xlog:jit+compilation if the compilation takes longer than
+  // LogCompilePhaseTimesAboveMillis.
+  class PhaseTimesLogger : public StackObj {
+   private:
+    Compile* const _compile;
+    const jlong _start_counter;
+    jlong _phase_counters[max_phase_timers];
+   public:
+    PhaseTimesLogger(Compile* C);
+    ~PhaseTimesLogger();
+  };
+
   // Information per category of alias (memory slice)
   class AliasType {
    private:
@@ -527,6 +542,7 @@ class Compile : public Phase {
   int                   _interpreter_frame_size;
 
   PhaseOutput*          _output;
+  jlong*                _phase_counters;        // Per phase elapsed counters, see PhaseTimesLogger
 
  public:
   // Accessors
@@ -972,6 +988,9 @@ class Compile : public Phase {
   CallGenerator*    call_generator(ciMethod* call_method, int vtable_index, bool call_does_dispatch,
                                    JVMState* jvms, bool allow_inline, float profile_factor, ciKlass* speculative_receiver_type = nullptr,
                                    bool allow_intrinsics = true);
+  // Type switch over the dominant receivers of a megamorphic call site.
+  CallGenerator*    polymorphic_call_generator(ciMethod* call_method, int vtable_index,
+                                               JVMState* jvms, float profile_factor);
   bool should_delay_inlining(ciMethod* call_method, JVMState* jvms) {
     return should_delay_string_inlining(call_method, jvms) ||
            should_delay_boxing_inlining(call_method, jvms) ||
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,115 @@ static void trace_type_profile(Compile* C, ciMethod* method, JVMState* jvms,
   }
 }
 
+// Collect the most frequent receivers of a megamorphic call site, beyond the two
+// receivers that ciCallProfile keeps, until they cover PolymorphicInlineCoveragePercent
+// of all calls. The receivers are sorted by decreasing count. Returns the number of
+// receivers, or 0 if PolymorphicInlineWidth receivers do not cover enough calls.
+static int polymorphic_receivers(ciMethod* caller, int bci, ciKlass** receivers, int* counts,
+                                 int capacity, int& total) {
+  total = 0;
+  ciMethodData* md = caller->method_data();
+  if (md == nullptr || !md->is_mature()) {
+    return 0;
+  }
+  ResourceMark rm;
+  ciProfileData* data = md->bci_to_data(bci);
+  if (data == nullptr || !data->is_ReceiverTypeData()) {
+    return 0;
+  }
+  ciReceiverTypeData* call = (ciReceiverTypeData*)data->as_ReceiverTypeData();
+  // Calls with receivers that did not fit into the profile are counted in the counter.
+  total = MAX2(call->count(), 0);
+  int length = 0;
+  for (uint row = 0; row < call->row_limit(); row++) {
+    ciKlass* receiver = call->receiver(row);
+    if (receiver == nullptr) {
+      continue;
+    }
+    int count = MAX2((int)call->receiver_count(row), 1);
+    total = saturated_add(total, count);
+    if (length == capacity) {
+      continue;
+    }
+    // Insertion sort by decreasing count.
+    int i = length;
+    for (; i > 0 && count > counts[i - 1]; i--) {
+      receivers[i] = receivers[i - 1];
+      counts[i] = counts[i - 1];
+    }
+    receivers[i] = receiver;
+    counts[i] = count;
+    length++;
+  }
+
+  int covered = 0;
+  for (int i = 0; i < length && i < (int)PolymorphicInlineWidth; i++) {
+    covered = saturated_add(covered, counts[i]);
+    if (100.0 * covered >= (double)PolymorphicInlineCoveragePercent * total) {
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+// Inline the dominant receivers of a megamorphic call site, each guarded by a
+// receiver class check. Calls with any other receiver trap and recompile, so
+// that a shift in the receiver distribution is picked up. If the call site
+// already trapped too often, we make a virtual call instead.
+CallGenerator* Compile::polymorphic_call_generator(ciMethod* callee, int vtable_index,
+                                                   JVMState* jvms, float prof_factor) {
+  ciMethod* caller = jvms->method();
+  int bci = jvms->bci();
+  const int max_receivers = 8; // Upper bound of TypeProfileWidth
+  ciKlass* receivers[max_receivers];
+  int counts[max_receivers];
+  int total = 0;
+  int length = polymorphic_receivers(caller, bci, receivers, counts, max_receivers, total);
+  if (length < 2) {
+    return nullptr;
+  }
+
+  CallGenerator* hit_cgs[max_receivers];
+  ciMethod* receiver_methods[max_receivers];
+  for (int i = 0; i < length; i++) {
+    receiver_methods[i] = callee->resolve_invoke(caller->holder(), receivers[i]);
+    if (receiver_methods[i] == nullptr) {
+      return nullptr;
+    }
+    hit_cgs[i] = call_generator(receiver_methods[i], vtable_index, false /* call_does_dispatch */,
+                                jvms, true /* allow_inline */, prof_factor);
+    if (hit_cgs[i] == nullptr || !hit_cgs[i]->is_inline()) {
+      // Only worth it if all receivers are inlined.
+      return nullptr;
+    }
+  }
+
+  CallGenerator* cg;
+  if (!too_many_traps_or_recompiles(caller, bci, Deoptimization::Reason_bimorphic)) {
+    cg = CallGenerator::for_uncommon_trap(callee, Deoptimization::Reason_bimorphic,
+                                          Deoptimization::Action_maybe_recompile);
+  } else {
+    cg = IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                  : CallGenerator::for_virtual_call(callee, vtable_index);
+  }
+
+  // Build the type switch from the least to the most frequent receiver, so that
+  // the most frequent receiver is checked first. The probability of each check
+  // is conditional on the earlier checks having failed.
+  int remaining[max_receivers];
+  int missed = total;
+  for (int i = 0; i < length; i++) {
+    remaining[i] = missed;
+    missed -= counts[i];
+  }
+  for (int i = length - 1; i >= 0 && cg != nullptr; i--) {
+    float hit_prob = (float)counts[i] / (float)MAX2(remaining[i], 1);
+    trace_type_profile(this, caller, jvms, receiver_methods[i], receivers[i], total, counts[i]);
+    cg = CallGenerator::for_predicted_call(receivers[i], cg, hit_cgs[i], hit_prob);
+  }
+  return cg;
+}
+
 CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool call_does_dispatch,
                                        JVMState* jvms, bool allow_inline,
                                        float prof_factor, ciKlass* speculative_receiver_type,
@@ -251,6 +360,13 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = nullptr;
         }
       }
+      if (receiver_method == nullptr && speculative_receiver_type == nullptr &&
+          morphism != 1 && morphism != 2 && PolymorphicInlineWidth >= 2) {
+        CallGenerator* cg = polymorphic_call_generator(callee, vtable_index, jvms, prof_factor);
+        if (cg != nullptr) {
+          return cg;
+        }
+      }
       if (receiver_method == nullptr &&
           (have_major_receiver || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -487,6 +487,27 @@ bool ConnectionGraph::can_reduce_phi_check_inputs(PhiNode* ophi) const {
   return found_sr_allocate;
 }
 
+// A Phi at a loop head is only reduced if all its inputs are scalar replaceable
+// allocations, i.e. the object of the previous iteration is always replaced by
+// a new one, as for accumulator objects. Other inputs could reference the Phi
+// itself through the backedge.
+bool ConnectionGraph::can_reduce_loop_phi(PhiNode* ophi) const {
+  int opc = ophi->region()->Opcode();
+  if (!ReduceAllocationMergesInLoops || (opc != Op_Loop && opc != Op_CountedLoop)) {
+    return false;
+  }
+
+  for (uint i = 1; i < ophi->req(); i++) {
+    JavaObjectNode* ptn = unique_java_object(ophi->in(i));
+    if (ptn == nullptr || !ptn->scalar_replaceable() || ptn->ideal_node()->Opcode() != Op_Allocate) {
+      NOT_PRODUCT(if (TraceReduceAllocationMerges) tty->print_cr("Can NOT reduce loop Phi %d on invocation %d. %dth input isn't a SR Allocate.", ophi->_idx, _invocation, i);)
+      return false;
+    }
+  }
+
+  return true;
+}
+
 // We can reduce the Cmp if it's a comparison between the Phi and a constant.
 // I require the 'other' input to be a constant so that I can move the Cmp
 // around safely.
@@ -618,7 +639,11 @@ bool ConnectionGraph::can_reduce_phi(PhiNode* ophi) const {
   // If there was an error attempting to reduce allocation merges for this
   // method we might have disabled the compilation and be retrying with RAM
   // disabled.
-  if (!_compile->do_reduce_allocation_merges() || ophi->region()->Opcode() != Op_Region) {
+  if (!_compile->do_reduce_allocation_merges()) {
+    return false;
+  }
+
+  if (ophi->region()->Opcode() != Op_Region && !can_reduce_loop_phi(ophi)) {
     return false;
   }
 
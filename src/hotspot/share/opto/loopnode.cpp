@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -4146,8 +4146,18 @@ void PhaseIdealLoop::replace_parallel_iv(IdealLoopTree *loop) {
         incr2->req() != 3 ||
         incr2->in(1)->uncast() != phi2 ||
         incr2 == incr ||
-        (incr2->Opcode() != Op_AddI && incr2->Opcode() != Op_AddL) ||
-        !incr2->in(2)->is_Con()) {
+        (incr2->Opcode() != Op_AddI && incr2->Opcode() != Op_AddL)) {
+      continue;
+    }
+    if (!incr2->in(2)->is_Con()) {
+      // The stride of the secondary IV is not a constant. Range checks indexed by it
+      // cannot be eliminated, since they would need a loop invariant scale.
+#ifndef PRODUCT
+      if (TraceLoopOpts) {
+        tty->print("Parallel IV with variable stride not converted: %d ", phi2->_idx);
+        loop->dump_head();
+      }
+#endif
       continue;
     }
 
@@ -4184,7 +4194,14 @@ void PhaseIdealLoop::replace_parallel_iv(IdealLoopTree *loop) {
     jlong ratio_con = stride_con2 / stride_con;
 
     if ((ratio_con * stride_con) != stride_con2) { // Check for exact (no remainder)
-        continue;
+#ifndef PRODUCT
+      if (TraceLoopOpts) {
+        tty->print("Parallel IV with stride " JLONG_FORMAT " not a multiple of " JLONG_FORMAT " not converted: %d ",
+                   stride_con2, stride_con, phi2->_idx);
+        loop->dump_head();
+      }
+#endif
+      continue;
     }
 
 #ifndef PRODUCT
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -680,6 +680,16 @@ Node *PhaseIdealLoop::convert_add_to_muladd(Node* n) {
   return nn;
 }
 
+// Can SuperWord turn a CMove of type 'bt', or a compare of type 'bt' that
+// feeds one, into a vector of the widest auto-vectorization size?
+static bool is_vector_cmove_supported(int vopc, BasicType bt) {
+  if (bt != T_INT && bt != T_LONG && bt != T_FLOAT && bt != T_DOUBLE) {
+    return false;
+  }
+  int vlen = Matcher::max_vector_size_auto_vectorization(bt);
+  return vlen >= 2 && Matcher::match_rule_supported_vector(vopc, vlen, bt);
+}
+
 //------------------------------conditional_move-------------------------------
 // Attempt to replace a Phi with a conditional move.  We have some pretty
 // strict profitability requirements.  All Phis at the merge point must
@@ -711,6 +721,12 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Always convert to CMOVE if all results are used only outside this loop.
   bool used_inside_loop = (r_loop == _ltree_root);
 
+  // CMoves of primitive values in an innermost counted loop may be
+  // vectorized as blends, which are profitable independent of how well the
+  // branch predicts.
+  bool vectorizable_cmove = UseVectorCmov && UseSuperWord &&
+                            r_loop->is_innermost() && r_loop->_head->is_CountedLoop();
+
   // Check profitability
   int cost = 0;
   int phis = 0;
@@ -720,6 +736,9 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
     phis++;
     PhiNode* phi = out->as_Phi();
     BasicType bt = phi->type()->basic_type();
+    if (vectorizable_cmove && !is_vector_cmove_supported(Op_VectorBlend, bt)) {
+      vectorizable_cmove = false;
+    }
     switch (bt) {
     case T_DOUBLE:
     case T_FLOAT:
@@ -809,6 +828,14 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Avoid duplicated float compare.
   if (phis > 1 && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) return nullptr;
 
+  if (vectorizable_cmove) {
+    BasicType cmp_bt = cmp_op == Op_CmpI ? T_INT :
+                       cmp_op == Op_CmpL ? T_LONG :
+                       cmp_op == Op_CmpF ? T_FLOAT :
+                       cmp_op == Op_CmpD ? T_DOUBLE : T_ILLEGAL;
+    vectorizable_cmove = is_vector_cmove_supported(Op_VectorMaskCmp, cmp_bt);
+  }
+
   float infrequent_prob = PROB_UNLIKELY_MAG(3);
   // Ignore cost and blocks frequency if CMOVE can be moved outside the loop.
   if (used_inside_loop) {
@@ -825,6 +852,8 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // we are going to predict accurately all the time.
   if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
     //keep going
+  } else if (vectorizable_cmove && used_inside_loop) {
+    //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
     return nullptr;
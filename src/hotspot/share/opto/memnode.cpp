@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2024, Alibaba Group Holding Limited. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -3371,6 +3371,303 @@ void MergePrimitiveStores::trace(const Node_List& merge_list, const Node* merged
 }
 #endif
 
+// MergePrimitiveLoads is the load side counterpart of MergePrimitiveStores. It
+// is applied to the root of an OrI/OrL tree that assembles a value from adjacent
+// byte loads, as it is common for manual decoding of little or big endian data:
+//
+//   int v = (a[i + 0] & 0xff)       |
+//           (a[i + 1] & 0xff) <<  8 |
+//           (a[i + 2] & 0xff) << 16 |
+//           (a[i + 3]       ) << 24;
+//
+// The tree is replaced by a single wide load, followed by a ReverseBytes if the
+// bytes are in reverse platform order. All byte loads must have the same memory
+// state, so there is no store in between. The wide load is placed at the control
+// of the byte load that is dominated by the controls of all others, i.e. after
+// all their RangeChecks have passed. Like for MergeStores, the merging is delayed
+// until the RangeChecks have been smeared in the post loop opts IGVN phase.
+class MergePrimitiveLoads : public StackObj {
+private:
+  static const int max_terms = 8;
+
+  // A term of the Or tree: (load << shift)
+  struct Term {
+    LoadNode* _load;
+    int       _shift;
+    bool      _is_unsigned;
+  };
+
+  PhaseGVN* const _phase;
+  Node* const     _or;
+  const BasicType _bt;
+  Term            _terms[max_terms];
+  int             _num_terms;
+
+  bool collect_terms(Node* n, int depth);
+  bool parse_term(Node* n, Term& term) const;
+  bool sort_terms();
+  bool is_compatible_load(int idx) const;
+  Node* find_merged_load_ctrl() const;
+  bool find_address_order(bool& ascending) const;
+
+public:
+  MergePrimitiveLoads(PhaseGVN* phase, Node* or_node) :
+    _phase(phase), _or(or_node),
+    _bt(or_node->Opcode() == Op_OrI ? T_INT : T_LONG),
+    _num_terms(0) {
+    assert(or_node->Opcode() == Op_OrI || or_node->Opcode() == Op_OrL, "must be Or");
+  }
+
+  Node* run();
+};
+
+Node* LoadNode::merge_primitive_loads(PhaseGVN* phase, Node* or_node) {
+  MergePrimitiveLoads merge(phase, or_node);
+  return merge.run();
+}
+
+Node* MergePrimitiveLoads::run() {
+  // Only the root of the Or tree is merged
+  for (DUIterator_Fast imax, i = _or->fast_outs(imax); i < imax; i++) {
+    if (_or->fast_out(i)->Opcode() == _or->Opcode()) {
+      return nullptr;
+    }
+  }
+
+  if (!collect_terms(_or, 0) || !sort_terms()) {
+    return nullptr;
+  }
+
+  if (!_phase->C->merge_stores_phase()) {
+    // Wait for the RangeChecks between the loads to be smeared, see StoreNode::Ideal.
+    _phase->C->record_for_merge_stores_igvn(_or);
+    return nullptr;
+  }
+
+  const LoadNode* first = _terms[0]._load;
+  for (int i = 1; i < _num_terms; i++) {
+    if (!is_compatible_load(i)) {
+      return nullptr;
+    }
+  }
+
+  bool ascending = true;
+  if (!find_address_order(ascending)) {
+    return nullptr;
+  }
+#ifdef VM_LITTLE_ENDIAN
+  const bool reverse = !ascending;
+#else
+  const bool reverse = ascending;
+#endif
+
+  // The sign of the highest byte matters only if it is not at the top of the result.
+  const bool is_unsigned = _terms[_num_terms - 1]._is_unsigned;
+  BasicType load_bt = T_ILLEGAL;
+  const Type* load_type = nullptr;
+  int reverse_opc = 0;
+  switch (_num_terms) {
+    case 2:
+      load_bt     = is_unsigned ? T_CHAR : T_SHORT;
+      load_type   = is_unsigned ? TypeInt::CHAR : TypeInt::SHORT;
+      reverse_opc = is_unsigned ? Op_ReverseBytesUS : Op_ReverseBytesS;
+      break;
+    case 4:
+      load_bt     = T_INT;
+      load_type   = TypeInt::INT;
+      reverse_opc = Op_ReverseBytesI;
+      break;
+    case 8:
+      load_bt     = T_LONG;
+      load_type   = TypeLong::LONG;
+      reverse_opc = Op_ReverseBytesL;
+      break;
+    default:
+      ShouldNotReachHere();
+  }
+  if (reverse && !Matcher::match_rule_supported(reverse_opc)) {
+    return nullptr;
+  }
+
+  Node* ctrl = find_merged_load_ctrl();
+  if (ctrl == nullptr) {
+    return nullptr;
+  }
+
+  LoadNode::ControlDependency control_dependency = LoadNode::DependsOnlyOnTest;
+  for (int i = 0; i < _num_terms; i++) {
+    if (_terms[i]._load->control_dependency() != LoadNode::DependsOnlyOnTest) {
+      control_dependency = LoadNode::Pinned;
+    }
+  }
+
+  const LoadNode* lowest = ascending ? _terms[0]._load : _terms[_num_terms - 1]._load;
+  Node* merged_load = LoadNode::make(*_phase, ctrl, first->in(MemNode::Memory), lowest->in(MemNode::Address),
+                                     first->adr_type(), load_type, load_bt, MemNode::unordered,
+                                     control_dependency, false /* require_atomic_access */,
+                                     false /* unaligned */, true /* mismatched */);
+  if (!reverse) {
+    return merged_load;
+  }
+  merged_load = _phase->transform(merged_load);
+  switch (reverse_opc) {
+    case Op_ReverseBytesUS: return new ReverseBytesUSNode(merged_load);
+    case Op_ReverseBytesS:  return new ReverseBytesSNode(merged_load);
+    case Op_ReverseBytesI:  return new ReverseBytesINode(merged_load);
+    case Op_ReverseBytesL:  return new ReverseBytesLNode(merged_load);
+    default:
+      ShouldNotReachHere();
+      return nullptr;
+  }
+}
+
+bool MergePrimitiveLoads::collect_terms(Node* n, int depth) {
+  if (n->Opcode() == _or->Opcode()) {
+    // A tree with at most max_terms leaves is not deeper than max_terms
+    return depth < max_terms &&
+           collect_terms(n->in(1), depth + 1) &&
+           collect_terms(n->in(2), depth + 1);
+  }
+  if (_num_terms == max_terms) {
+    return false;
+  }
+  return parse_term(n, _terms[_num_terms++]);
+}
+
+// Detect pattern: (load << shift), where load is a LoadUB or a LoadB masked with 0xff,
+// and for long trees converted with ConvI2L. A LoadB without mask is accepted as well,
+// its sign is only ok for the highest byte, see sort_terms.
+bool MergePrimitiveLoads::parse_term(Node* n, Term& term) const {
+  const int lshift_opc = _bt == T_INT ? Op_LShiftI : Op_LShiftL;
+  const int and_opc    = _bt == T_INT ? Op_AndI    : Op_AndL;
+
+  int shift = 0;
+  if (n->Opcode() == lshift_opc) {
+    if (!n->in(2)->is_ConI()) {
+      return false;
+    }
+    shift = n->in(2)->get_int();
+    n = n->in(1);
+  }
+  if (shift < 0 || shift >= type2aelembytes(_bt) * BitsPerByte || shift % BitsPerByte != 0) {
+    return false;
+  }
+
+  bool is_masked = false;
+  if (n->Opcode() == and_opc) {
+    const Type* mask = _phase->type(n->in(2));
+    is_masked = _bt == T_INT ? mask == TypeInt::make(0xff) : mask == TypeLong::make(0xff);
+    if (!is_masked) {
+      return false;
+    }
+    n = n->in(1);
+  }
+  if (_bt == T_LONG) {
+    if (n->Opcode() != Op_ConvI2L) {
+      return false;
+    }
+    n = n->in(1);
+  }
+  if (n->Opcode() != Op_LoadB && n->Opcode() != Op_LoadUB) {
+    return false;
+  }
+
+  LoadNode* load = n->as_Load();
+  if (!load->is_unordered() || load->is_mismatched_access()) {
+    return false;
+  }
+  term._load = load;
+  term._shift = shift;
+  term._is_unsigned = is_masked || load->Opcode() == Op_LoadUB;
+  return true;
+}
+
+// Sort the terms by shift and check that they cover the low bytes of the result without gaps.
+bool MergePrimitiveLoads::sort_terms() {
+  const bool is_valid_size = _bt == T_INT ? (_num_terms == 2 || _num_terms == 4) : _num_terms == 8;
+  if (!is_valid_size) {
+    return false;
+  }
+  for (int i = 1; i < _num_terms; i++) {
+    Term term = _terms[i];
+    int j = i - 1;
+    for (; j >= 0 && _terms[j]._shift > term._shift; j--) {
+      _terms[j + 1] = _terms[j];
+    }
+    _terms[j + 1] = term;
+  }
+  for (int i = 0; i < _num_terms; i++) {
+    if (_terms[i]._shift != i * BitsPerByte) {
+      return false;
+    }
+    // A sign extended byte would clobber the bytes above it.
+    if (i < _num_terms - 1 && !_terms[i]._is_unsigned) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Check that the load of the term at idx has the same memory state and slice as the load of
+// the first term, and that it is not used by another term.
+bool MergePrimitiveLoads::is_compatible_load(int idx) const {
+  const LoadNode* load = _terms[idx]._load;
+  const LoadNode* first = _terms[0]._load;
+  if (load->in(MemNode::Memory) != first->in(MemNode::Memory) ||
+      _phase->C->get_alias_index(load->adr_type()) != _phase->C->get_alias_index(first->adr_type())) {
+    return false;
+  }
+  for (int i = 0; i < idx; i++) {
+    if (_terms[i]._load == load) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Check that the loads are adjacent in the order of the shifts, either with ascending or
+// with descending addresses.
+bool MergePrimitiveLoads::find_address_order(bool& ascending) const {
+  ResourceMark rm;
+#ifndef PRODUCT
+  const TraceMemPointer trace(false, false, false, false);
+#endif
+  for (int i = 0; i < _num_terms - 1; i++) {
+    const MemPointer pointer_lo(_terms[i]._load NOT_PRODUCT(COMMA trace));
+    const MemPointer pointer_hi(_terms[i + 1]._load NOT_PRODUCT(COMMA trace));
+    bool is_ascending;
+    if (pointer_lo.is_adjacent_to_and_before(pointer_hi)) {
+      is_ascending = true;
+    } else if (pointer_hi.is_adjacent_to_and_before(pointer_lo)) {
+      is_ascending = false;
+    } else {
+      return false;
+    }
+    if (i > 0 && is_ascending != ascending) {
+      return false;
+    }
+    ascending = is_ascending;
+  }
+  return true;
+}
+
+// The merged load must be placed after the controls of all byte loads.
+Node* MergePrimitiveLoads::find_merged_load_ctrl() const {
+  Node* ctrl = nullptr;
+  for (int i = 0; i < _num_terms; i++) {
+    Node* c = _terms[i]._load->in(MemNode::Control);
+    if (c == nullptr || c == ctrl) {
+      continue;
+    }
+    if (ctrl == nullptr || _phase->is_dominator(ctrl, c)) {
+      ctrl = c;
+    } else if (!_phase->is_dominator(c, ctrl)) {
+      return nullptr;
+    }
+  }
+  return ctrl;
+}
+
 //------------------------------Ideal------------------------------------------
 // Change back-to-back Store(, p, x) -> Store(m, p, y) to Store(m, p, x).
 // When a store immediately follows a relevant allocation/initialization,
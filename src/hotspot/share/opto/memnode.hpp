@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2024, Alibaba Group Holding Limited. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -239,6 +239,10 @@ class LoadNode : public MemNode {
                     bool require_atomic_access = false, bool unaligned = false, bool mismatched = false, bool unsafe = false,
                     uint8_t barrier_data = 0);
 
+  // Replace an OrI/OrL tree of shifted adjacent byte loads by a single wide
+  // load, see MergePrimitiveLoads. Returns nullptr if the tree does not match.
+  static Node* merge_primitive_loads(PhaseGVN* phase, Node* or_node);
+
   virtual uint hash()   const;  // Check the type
 
   // Handle algebraic identities here.  If we have an identity, return the Node
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -87,6 +87,12 @@ class InlineTree : public AnyObj {
                              ciMethod* caller_method,
                              int caller_bci,
                              ciCallProfile& profile);
+  bool        is_beneficial_hot_method(ciMethod* callee_method,
+                                       JVMState* caller_jvms,
+                                       int size,
+                                       double freq) const;
+  static int  count_specialized_arguments(ciMethod* callee_method,
+                                          JVMState* caller_jvms);
   void print_inlining(ciMethod* callee_method, JVMState* jvm, bool success) const;
 
   InlineTree* caller_tree()       const { return _caller_tree;  }
@@ -559,6 +565,8 @@ class Parse : public GraphKit {
   float   dynamic_branch_prediction(float &cnt, BoolTest::mask btest, Node* test);
   float   branch_prediction(float &cnt, BoolTest::mask btest, int target_bci, Node* test);
   bool    seems_never_taken(float prob) const;
+  bool    seems_cold_escape_path(float prob) const;
+  bool    map_has_live_allocation() const;
   bool    path_is_suitable_for_uncommon_trap(float prob) const;
 
   void    do_ifnull(BoolTest::mask btest, Node* c);
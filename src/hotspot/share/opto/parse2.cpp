@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1336,6 +1336,25 @@ bool Parse::seems_never_taken(float prob) const {
   return prob < PROB_MIN;
 }
 
+// A rarely taken path on which allocations may escape is better trapped,
+// so that escape analysis can scalar replace them on the frequent path.
+// If the path is taken, deoptimization materializes the objects.
+bool Parse::seems_cold_escape_path(float prob) const {
+  return prob < ColdEscapePathTrapProbability &&
+         DoEscapeAnalysis && EliminateAllocations &&
+         map_has_live_allocation();
+}
+
+bool Parse::map_has_live_allocation() const {
+  for (uint i = TypeFunc::Parms; i < map()->req(); i++) {
+    Node* n = map()->in(i);
+    if (n != nullptr && AllocateNode::Ideal_allocation(n) != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //-------------------------------repush_if_args--------------------------------
 // Push arguments of an "if" bytecode back onto the stack by adjusting _sp.
 inline int Parse::repush_if_args() {
@@ -1616,7 +1635,7 @@ bool Parse::path_is_suitable_for_uncommon_trap(float prob) const {
   if (!UseInterpreter) {
     return false;
   }
-  return seems_never_taken(prob) &&
+  return (seems_never_taken(prob) || seems_cold_escape_path(prob)) &&
          !C->too_many_traps(method(), bci(), Deoptimization::Reason_unstable_if);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1640,7 +1640,10 @@ bool SuperWord::implemented(const Node_List* pack, const uint size) const {
       return false;
     } else if (p0->is_Cmp()) {
       // Cmp -> Bool -> Cmove
-      retValue = UseVectorCmov;
+      // VectorMaskCmp is created with the signed or float predicates of the
+      // Bool, so unsigned and pointer compares cannot be vectorized.
+      retValue = UseVectorCmov &&
+                 (opc == Op_CmpI || opc == Op_CmpL || opc == Op_CmpF || opc == Op_CmpD);
     } else if (VectorNode::is_scalar_op_that_returns_int_but_vector_op_returns_long(opc)) {
       // Requires extra vector long -> int conversion.
       retValue = VectorNode::implemented(opc, size, T_LONG) &&
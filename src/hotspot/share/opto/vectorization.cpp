@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2023, Arm Limited. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -23,8 +23,10 @@
  */
 
 #include "opto/addnode.hpp"
+#include "opto/castnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/convertnode.hpp"
+#include "opto/matcher.hpp"
 #include "opto/mulnode.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/vectorization.hpp"
@@ -286,7 +288,13 @@ void VLoopDependencyGraph::construct() {
         if (n1->is_Load() && n2->is_Load()) { continue; }
 
         const VPointer& p2 = _vpointers.vpointer(n2);
-        if (!p1.never_overlaps_with(p2)) {
+        if (p1.never_overlaps_with(p2)) {
+          // Never overlapping memory
+        } else if (can_speculate_never_overlaps(n1, p1, n2, p2)) {
+          // Possibly overlapping memory, but we check at runtime that it does not overlap
+          _speculative_aliasing_pairs.append(n2);
+          _speculative_aliasing_pairs.append(n1);
+        } else {
           // Possibly overlapping memory
           memory_pred_edges.append(_body.bb_idx(n2));
         }
@@ -305,6 +313,25 @@ void VLoopDependencyGraph::construct() {
   NOT_PRODUCT( if (_vloop.is_trace_dependency_graph()) { print(); } )
 }
 
+bool VLoopDependencyGraph::can_speculate_never_overlaps(const MemNode* n1, const VPointer& p1,
+                                                        const MemNode* n2, const VPointer& p2) const {
+  if (!UseAutoVectorizationSpeculativeAliasingChecks ||
+      !Matcher::match_rule_supported(Op_CmpUL) ||
+      !p1.can_speculate_never_overlaps_with(p2)) {
+    return false;
+  }
+#ifdef _LP64
+  // For native memory, all decompositions are (SAFE1), and so the distance of the
+  // two MemPointers is the distance of the underlying pointers. For array accesses,
+  // this only holds if they are not Unsafe, see MemPointerParser::is_safe_to_decompose_op.
+  return p1.mem_pointer().base().is_native() ||
+         (!n1->is_unsafe_access() && !n2->is_unsafe_access());
+#else
+  // The pointers wrap around at 32 bits, but the distance is computed in 64 bits.
+  return false;
+#endif
+}
+
 void VLoopDependencyGraph::add_node(MemNode* n, GrowableArray<int>& memory_pred_edges) {
   assert(_dependency_nodes.at_grow(_body.bb_idx(n), nullptr) == nullptr, "not yet created");
   assert(!memory_pred_edges.is_empty(), "no need to create a node without edges");
@@ -430,6 +457,34 @@ void VLoopDependencyGraph::PredsIterator::next() {
   }
 }
 
+// Sum up all summands except the iv-summand, as long values. An object base is
+// excluded as well: if two accesses are in the same object, the bases cancel out.
+Node* VPointer::make_invar_value_for_speculative_check(Node* ctrl) const {
+  PhaseIdealLoop* phase = _vloop.phase();
+  Node* invar = phase->igvn().longcon(0);
+  mem_pointer().for_each_non_empty_summand([&] (const MemPointerSummand& s) {
+    Node* variable = s.variable();
+    if (variable == _vloop.iv()) { return; }
+    if (mem_pointer().base().is_object() && variable == mem_pointer().base().object()) { return; }
+
+    if (variable->bottom_type()->basic_type() == T_ADDRESS) {
+      variable = new CastP2XNode(nullptr, variable);
+      phase->register_new_node(variable, ctrl);
+    }
+    if (variable->bottom_type()->basic_type() == T_INT) {
+      variable = new ConvI2LNode(variable);
+      phase->register_new_node(variable, ctrl);
+    }
+    if (!s.scale().is_one()) {
+      variable = new MulLNode(variable, phase->igvn().longcon(s.scale().value()));
+      phase->register_new_node(variable, ctrl);
+    }
+    invar = new AddLNode(invar, variable);
+    phase->register_new_node(invar, ctrl);
+  });
+  return invar;
+}
+
 #ifndef PRODUCT
 void VPointer::print_on(outputStream* st, bool end_with_cr) const {
   st->print("VPointer[");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2023, Arm Limited. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -161,6 +161,21 @@ class VLoop : public StackObj {
            _multiversioning_fast_proj != nullptr;
   }
 
+  // The speculative checks are inserted just before the auto vectorization Parse
+  // Predicate, or else just before the multiversion_if.
+  Node* speculative_check_ctrl() const {
+    assert(are_speculative_checks_possible(), "otherwise we cannot make speculative assumptions");
+    if (_auto_vectorization_parse_predicate_proj != nullptr) {
+      return _auto_vectorization_parse_predicate_proj->in(0)->in(0);
+    }
+    return _multiversioning_fast_proj->in(0)->in(0);
+  }
+
+  // Can the node be used as an input to a speculative check?
+  bool is_available_for_speculative_check(Node* n) const {
+    return phase()->is_dominator(phase()->get_ctrl(n), speculative_check_ctrl());
+  }
+
   // Estimate maximum size for data structures, to avoid repeated reallocation
   int estimated_body_length() const { return lpt()->_body.size(); };
   int estimated_node_count()  const { return (int)(1.10 * phase()->C->unique()); };
@@ -585,6 +600,11 @@ class VLoopDependencyGraph : public StackObj {
   // Node depth in DAG: bb_idx -> depth
   GrowableArray<int> _depths;
 
+  // Pairs of memops, stored consecutively, for which we did not add a memory edge
+  // because we speculate that they never overlap. This must be checked at runtime,
+  // see VTransform::apply_speculative_runtime_checks.
+  GrowableArray<MemNode*> _speculative_aliasing_pairs;
+
 public:
   VLoopDependencyGraph(Arena* arena,
                        const VLoop& vloop,
@@ -603,15 +623,19 @@ class VLoopDependencyGraph : public StackObj {
     _depths(arena,
             vloop.estimated_body_length(),
             vloop.estimated_body_length(),
-            0) {}
+            0),
+    _speculative_aliasing_pairs(arena, 0, 0, nullptr) {}
   NONCOPYABLE(VLoopDependencyGraph);
 
   void construct();
+  const GrowableArray<MemNode*>& speculative_aliasing_pairs() const { return _speculative_aliasing_pairs; }
   bool independent(Node* s1, Node* s2) const;
   bool mutually_independent(const Node_List* nodes) const;
 
 private:
   void add_node(MemNode* n, GrowableArray<int>& memory_pred_edges);
+  bool can_speculate_never_overlaps(const MemNode* n1, const VPointer& p1,
+                                    const MemNode* n2, const VPointer& p2) const;
   int depth(const Node* n) const { return _depths.at(_body.bb_idx(n)); }
   void set_depth(const Node* n, int d) { _depths.at_put(_body.bb_idx(n), d); }
   int find_max_pred_depth(const Node* n) const;
@@ -934,6 +958,27 @@ class VPointer : public ArenaObj {
     return mem_pointer().never_overlaps_with(other.mem_pointer());
   }
 
+  // Two pointers with the same iv_scale are always at the same distance from each
+  // other, given by their invariant summands and cons. If we cannot prove that they
+  // never overlap, we can still check it with a speculative runtime check, see
+  // VTransform::add_speculative_aliasing_check. All summands must be available
+  // before the loop to compute the distance. For object bases, the distance is only
+  // meaningful in the same object, and if the accesses are not Unsafe, see
+  // VLoopDependencyGraph::can_speculate_never_overlaps.
+  bool can_speculate_never_overlaps_with(const VPointer& other) const {
+    if (!is_valid() || !other.is_valid()) { return false; }
+    if (!_vloop.are_speculative_checks_possible()) { return false; }
+    if (iv_scale() != other.iv_scale()) { return false; }
+    // With all summands the same, the distance is known, and the overlap is certain.
+    if (MemPointer::cmp_summands(mem_pointer(), other.mem_pointer()) == 0) { return false; }
+    if (mem_pointer().base().is_native() != other.mem_pointer().base().is_native()) { return false; }
+    return are_invar_summands_available_for_speculative_check() &&
+           other.are_invar_summands_available_for_speculative_check();
+  }
+
+  // Compute the long value of all summands except the iv-summand and an object base.
+  Node* make_invar_value_for_speculative_check(Node* ctrl) const;
+
   NOT_PRODUCT( void print_on(outputStream* st, bool end_with_cr = true) const; )
 
 private:
@@ -949,6 +994,24 @@ class VPointer : public ArenaObj {
     return 0;
   }
 
+  bool are_invar_summands_available_for_speculative_check() const {
+    bool is_available = true;
+    mem_pointer().for_each_non_empty_summand([&] (const MemPointerSummand& s) {
+      Node* variable = s.variable();
+      if (variable == _vloop.iv()) { return; }
+      if (mem_pointer().base().is_object() && variable == mem_pointer().base().object()) {
+        // Compared with CmpP, the oop is never used as a value.
+        is_available = is_available && _vloop.is_available_for_speculative_check(variable);
+        return;
+      }
+      const BasicType bt = variable->bottom_type()->basic_type();
+      is_available = is_available &&
+                     (bt == T_INT || bt == T_LONG || (bt == T_ADDRESS && mem_pointer().base().is_native())) &&
+                     _vloop.is_available_for_speculative_check(variable);
+    });
+    return is_available;
+  }
+
   // Check the conditions for a "valid" VPointer.
   bool init_is_valid() const {
     return init_is_base_known() &&
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 #include "opto/vectornode.hpp"
 #include "opto/castnode.hpp"
 #include "opto/convertnode.hpp"
+#include "opto/movenode.hpp"
 
 void VTransformGraph::add_vtnode(VTransformNode* vtnode) {
   assert(vtnode->_idx == _vtnodes.length(), "position must match idx");
@@ -169,9 +170,67 @@ void VTransform::apply_speculative_runtime_checks() {
       add_speculative_alignment_check(vp.mem_pointer().base().native(), ObjectAlignmentInBytes);
     }
   }
+
+  // The dependency graph speculated that some memory accesses never overlap. All pairs
+  // of accesses with the same summands share a single runtime check, which covers the
+  // union of their overlap ranges, see add_speculative_aliasing_check.
+  const GrowableArray<MemNode*>& pairs = _vloop_analyzer.dependency_graph().speculative_aliasing_pairs();
+#ifdef ASSERT
+  if (pairs.is_nonempty() && _trace._speculative_runtime_checks) {
+    tty->print_cr("\nVTransform::apply_speculative_runtime_checks: memory aliasing");
+  }
+#endif
+  for (int i = 0; i < pairs.length(); i += 2) {
+    const VPointer* p1 = nullptr;
+    const VPointer* p2 = nullptr;
+    speculative_aliasing_vpointers(i, p1, p2);
+
+    // Skip the pair if an earlier pair with the same summands already covered it.
+    bool is_covered = false;
+    for (int j = 0; j < i && !is_covered; j += 2) {
+      const VPointer* q1 = nullptr;
+      const VPointer* q2 = nullptr;
+      speculative_aliasing_vpointers(j, q1, q2);
+      is_covered = have_same_summands(*p1, *p2, *q1, *q2);
+    }
+    if (is_covered) { continue; }
+
+    // Accesses q1 and q2 overlap iff: -q2.size < q2 - q1 < q1.size
+    // With q2 - q1 = distance + (q2.con - q1.con), this is:
+    //   q1.con - q2.con - q2.size < distance < q1.con - q2.con + q1.size
+    // For all pairs with the same summands, we compute the union (lo, hi) of these ranges.
+    jlong lo = max_jlong;
+    jlong hi = min_jlong;
+    for (int k = i; k < pairs.length(); k += 2) {
+      const VPointer* q1 = nullptr;
+      const VPointer* q2 = nullptr;
+      speculative_aliasing_vpointers(k, q1, q2);
+      if (!have_same_summands(*p1, *p2, *q1, *q2)) { continue; }
+      lo = MIN2(lo, (jlong)q1->con() - (jlong)q2->con() - (jlong)q2->size());
+      hi = MAX2(hi, (jlong)q1->con() - (jlong)q2->con() + (jlong)q1->size());
+    }
+    add_speculative_aliasing_check(*p1, *p2, lo, hi);
+  }
+}
+
+// Order the VPointers of the pair by their summands, so that all pairs with the
+// same summands share a single runtime check, independent of their order.
+void VTransform::speculative_aliasing_vpointers(int i, const VPointer*& p1, const VPointer*& p2) const {
+  const GrowableArray<MemNode*>& pairs = _vloop_analyzer.dependency_graph().speculative_aliasing_pairs();
+  p1 = &vpointer(pairs.at(i));
+  p2 = &vpointer(pairs.at(i + 1));
+  if (MemPointer::cmp_summands(p1->mem_pointer(), p2->mem_pointer()) > 0) {
+    swap(p1, p2);
+  }
+}
+
+bool VTransform::have_same_summands(const VPointer& p1, const VPointer& p2,
+                                    const VPointer& q1, const VPointer& q2) {
+  return MemPointer::cmp_summands(p1.mem_pointer(), q1.mem_pointer()) == 0 &&
+         MemPointer::cmp_summands(p2.mem_pointer(), q2.mem_pointer()) == 0;
 }
 
-#define TRACE_SPECULATIVE_ALIGNMENT_CHECK(node) {                     \
+#define TRACE_SPECULATIVE_RUNTIME_CHECK(node) {                       \
   DEBUG_ONLY(                                                         \
     if (_trace._align_vector || _trace._speculative_runtime_checks) { \
       tty->print("  " #node ": ");                                    \
@@ -182,7 +241,7 @@ void VTransform::apply_speculative_runtime_checks() {
 
 // Check: (node % alignment) == 0.
 void VTransform::add_speculative_alignment_check(Node* node, juint alignment) {
-  TRACE_SPECULATIVE_ALIGNMENT_CHECK(node);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(node);
   Node* ctrl = phase()->get_ctrl(node);
 
   // Cast adr/long -> int
@@ -190,32 +249,82 @@ void VTransform::add_speculative_alignment_check(Node* node, juint alignment) {
     // adr -> int/long
     node = new CastP2XNode(nullptr, node);
     phase()->register_new_node(node, ctrl);
-    TRACE_SPECULATIVE_ALIGNMENT_CHECK(node);
+    TRACE_SPECULATIVE_RUNTIME_CHECK(node);
   }
   if (node->bottom_type()->basic_type() == T_LONG) {
     // long -> int
     node  = new ConvL2INode(node);
     phase()->register_new_node(node, ctrl);
-    TRACE_SPECULATIVE_ALIGNMENT_CHECK(node);
+    TRACE_SPECULATIVE_RUNTIME_CHECK(node);
   }
 
   Node* mask_alignment = igvn().intcon(alignment-1);
   Node* base_alignment = new AndINode(node, mask_alignment);
   phase()->register_new_node(base_alignment, ctrl);
-  TRACE_SPECULATIVE_ALIGNMENT_CHECK(mask_alignment);
-  TRACE_SPECULATIVE_ALIGNMENT_CHECK(base_alignment);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(mask_alignment);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(base_alignment);
 
   Node* zero = igvn().intcon(0);
   Node* cmp_alignment = CmpNode::make(base_alignment, zero, T_INT, false);
   BoolNode* bol_alignment = new BoolNode(cmp_alignment, BoolTest::eq);
   phase()->register_new_node(cmp_alignment, ctrl);
   phase()->register_new_node(bol_alignment, ctrl);
-  TRACE_SPECULATIVE_ALIGNMENT_CHECK(cmp_alignment);
-  TRACE_SPECULATIVE_ALIGNMENT_CHECK(bol_alignment);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(cmp_alignment);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(bol_alignment);
 
   add_speculative_check(bol_alignment);
 }
 
+// The distance of the accesses is (invar2 - invar1), and the check is:
+//   distance <= lo || distance >= hi
+// Computed with a single unsigned comparison:
+//   distance - (lo + 1) >=u (hi - lo - 1)
+// For accesses into memory objects, the distance is only meaningful if both are
+// in the same object. If they are in different objects, they never overlap, and
+// we pick a distance that passes the check:
+//   distance = (base1 == base2) ? (invar2 - invar1) : hi
+void VTransform::add_speculative_aliasing_check(const VPointer& p1, const VPointer& p2, jlong lo, jlong hi) {
+  assert(lo < hi, "non-empty range");
+  Node* ctrl = _vloop.speculative_check_ctrl();
+
+  Node* invar1 = p1.make_invar_value_for_speculative_check(ctrl);
+  Node* invar2 = p2.make_invar_value_for_speculative_check(ctrl);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(invar1);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(invar2);
+
+  Node* distance = new SubLNode(invar2, invar1);
+  phase()->register_new_node(distance, ctrl);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(distance);
+
+  const MemPointer::Base& base1 = p1.mem_pointer().base();
+  const MemPointer::Base& base2 = p2.mem_pointer().base();
+  if (base1.is_object() && base1.object() != base2.object()) {
+    Node* cmp_base = new CmpPNode(base1.object(), base2.object());
+    BoolNode* bol_base = new BoolNode(cmp_base, BoolTest::eq);
+    phase()->register_new_node(cmp_base, ctrl);
+    phase()->register_new_node(bol_base, ctrl);
+    TRACE_SPECULATIVE_RUNTIME_CHECK(bol_base);
+
+    distance = CMoveNode::make(bol_base, igvn().longcon(hi), distance, TypeLong::LONG);
+    phase()->register_new_node(distance, ctrl);
+    TRACE_SPECULATIVE_RUNTIME_CHECK(distance);
+  }
+
+  Node* shifted = new SubLNode(distance, igvn().longcon(java_add(lo, (jlong)1)));
+  phase()->register_new_node(shifted, ctrl);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(shifted);
+
+  Node* width = igvn().longcon(java_subtract(java_subtract(hi, lo), (jlong)1));
+  Node* cmp_aliasing = new CmpULNode(shifted, width);
+  BoolNode* bol_aliasing = new BoolNode(cmp_aliasing, BoolTest::ge);
+  phase()->register_new_node(cmp_aliasing, ctrl);
+  phase()->register_new_node(bol_aliasing, ctrl);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(cmp_aliasing);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(bol_aliasing);
+
+  add_speculative_check(bol_aliasing);
+}
+
 void VTransform::add_speculative_check(BoolNode* bol) {
   assert(_vloop.are_speculative_checks_possible(), "otherwise we cannot make speculative assumptions");
   ParsePredicateSuccessProj* parse_predicate_proj = _vloop.auto_vectorization_parse_predicate_proj();
@@ -229,7 +338,7 @@ void VTransform::add_speculative_check(BoolNode* bol) {
   }
   Node* iff_speculate = new_check_proj->in(0);
   igvn().replace_input_of(iff_speculate, 1, bol);
-  TRACE_SPECULATIVE_ALIGNMENT_CHECK(iff_speculate);
+  TRACE_SPECULATIVE_RUNTIME_CHECK(iff_speculate);
 }
 
 // Helper-class for VTransformGraph::has_store_to_load_forwarding_failure.
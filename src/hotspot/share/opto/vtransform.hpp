@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -250,6 +250,10 @@ class VTransform : public StackObj {
 
   void apply_speculative_runtime_checks();
   void add_speculative_alignment_check(Node* node, juint alignment);
+  void speculative_aliasing_vpointers(int i, const VPointer*& p1, const VPointer*& p2) const;
+  static bool have_same_summands(const VPointer& p1, const VPointer& p2,
+                                 const VPointer& q1, const VPointer& q2);
+  void add_speculative_aliasing_check(const VPointer& p1, const VPointer& p2, jlong lo, jlong hi);
   void add_speculative_check(BoolNode* bol);
 
   void apply_vectorization() const;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,12 @@ class RuntimeStub;
 
 class DowncallLinker: AllStatic {
 public:
+  // Stubs are not shared in the VM. Each stub is owned by the Java-side
+  // NativeEntryPoint that requested it, which deduplicates entry points with
+  // the same method type, ABI and argument/return moves in its own cache, and
+  // frees the stub through NEP_freeDowncallStub when it becomes unreachable.
+  // Critical downcalls (needs_transition == false) skip the thread state
+  // transition and safepoint poll altogether.
   static RuntimeStub* make_downcall_stub(BasicType*,
                                          int num_args,
                                          BasicType ret_bt,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -211,6 +211,11 @@ class CloseScopedMemoryClosure : public HandshakeClosure {
  * one or more threads is found inside a scoped method (that is, a method inside the ScopedMemoryAccess
  * class annotated with the '@Scoped' annotation), and whose local variables mention the session being
  * closed (deopt), this method returns false, signalling that the session cannot be closed safely.
+ *
+ * The handshake cannot be skipped based on a per-session epoch or counter: compiled code hoists
+ * the liveness check out of loops and does not record that it is inside a scoped access, so only
+ * inspecting each thread's frames at a handshake can tell whether the session may be in use.
+ * Threads without Java frames are cheap, as they return before walking the stack.
  */
 JVM_ENTRY(void, ScopedMemoryAccess_closeScope(JNIEnv *env, jobject receiver, jobject session, jobject error))
   CloseScopedMemoryClosure cl(session, error);
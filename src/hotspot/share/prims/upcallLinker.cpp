@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,6 +73,8 @@ JavaThread* UpcallLinker::maybe_attach_and_get_thread() {
 
 // modelled after JavaCallWrapper::JavaCallWrapper
 JavaThread* UpcallLinker::on_entry(UpcallStub::FrameData* context) {
+  // Only the first upcall from a native thread attaches it, later upcalls
+  // just find the JavaThread in thread local storage (see UpcallContext).
   JavaThread* thread = maybe_attach_and_get_thread();
   guarantee(thread->thread_state() == _thread_in_native, "wrong thread state for upcall");
   context->thread = thread;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -101,6 +101,9 @@
 #include "utilities/macros.hpp"
 #include "utilities/nativeCallStack.hpp"
 #include "utilities/ostream.hpp"
+#if INCLUDE_EPSILONGC
+#include "gc/epsilon/epsilonHeap.hpp"
+#endif // INCLUDE_EPSILONGC
 #if INCLUDE_G1GC
 #include "gc/g1/g1Arguments.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
@@ -603,6 +606,42 @@ WB_END
 
 #endif // INCLUDE_PARALLELGC
 
+#if INCLUDE_EPSILONGC
+
+class VM_WhiteBoxEpsilonArena : public VM_WhiteBoxOperation {
+ private:
+  const bool _reset;
+  bool _result;
+ public:
+  VM_WhiteBoxEpsilonArena(bool reset) : _reset(reset), _result(false) { }
+  bool result() const { return _result; }
+
+  void doit() {
+    EpsilonHeap* heap = EpsilonHeap::heap();
+    _result = _reset ? heap->reset_arena_to_checkpoint() : heap->checkpoint_arena();
+  }
+};
+
+WB_ENTRY(jboolean, WB_EpsilonCheckpointArena(JNIEnv* env, jobject o))
+  if (UseEpsilonGC) {
+    VM_WhiteBoxEpsilonArena op(false /* reset */);
+    VMThread::execute(&op);
+    return op.result();
+  }
+  THROW_MSG_0(vmSymbols::java_lang_UnsupportedOperationException(), "WB_EpsilonCheckpointArena: Epsilon GC is not enabled");
+WB_END
+
+WB_ENTRY(jboolean, WB_EpsilonResetArenaToCheckpoint(JNIEnv* env, jobject o))
+  if (UseEpsilonGC) {
+    VM_WhiteBoxEpsilonArena op(true /* reset */);
+    VMThread::execute(&op);
+    return op.result();
+  }
+  THROW_MSG_0(vmSymbols::java_lang_UnsupportedOperationException(), "WB_EpsilonResetArenaToCheckpoint: Epsilon GC is not enabled");
+WB_END
+
+#endif // INCLUDE_EPSILONGC
+
 #if INCLUDE_G1GC
 
 WB_ENTRY(jobject, WB_G1AuxiliaryMemoryUsage(JNIEnv* env))
@@ -2800,6 +2839,10 @@ static JNINativeMethod methods[] = {
 #if INCLUDE_PARALLELGC
   {CC"psVirtualSpaceAlignment",CC"()J",               (void*)&WB_PSVirtualSpaceAlignment},
   {CC"psHeapGenerationAlignment",CC"()J",             (void*)&WB_PSHeapGenerationAlignment},
+#endif
+#if INCLUDE_EPSILONGC
+  {CC"epsilonCheckpointArena", CC"()Z",               (void*)&WB_EpsilonCheckpointArena},
+  {CC"epsilonResetArenaToCheckpoint", CC"()Z",        (void*)&WB_EpsilonResetArenaToCheckpoint},
 #endif
   {CC"NMTMalloc",           CC"(J)J",                 (void*)&WB_NMTMalloc          },
   {CC"NMTMallocWithPseudoStack", CC"(JI)J",           (void*)&WB_NMTMallocWithPseudoStack},
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1422,6 +1422,26 @@ size_t Arguments::max_heap_for_compressed_oops() {
   NOT_LP64(ShouldNotReachHere(); return 0);
 }
 
+#ifdef _LP64
+// Tell the user which ObjectAlignmentInBytes would have allowed compressed
+// oops for this heap size. A larger alignment wastes some space per object
+// for padding but usually costs much less than uncompressed 64-bit oops.
+static void log_compressed_oops_alignment_hint(size_t max_heap_size, size_t displacement) {
+  if (!log_is_enabled(Info, gc, heap, coops)) {
+    return;
+  }
+  for (int alignment = ObjectAlignmentInBytes * 2; alignment <= 256; alignment *= 2) {
+    const uint64_t encoding_max = (uint64_t(max_juint) + 1) * alignment;
+    if (encoding_max - displacement >= max_heap_size) {
+      log_info(gc, heap, coops)("Max heap size %zu too large for Compressed Oops with "
+                                "ObjectAlignmentInBytes=%d, -XX:ObjectAlignmentInBytes=%d would allow them",
+                                max_heap_size, (int)ObjectAlignmentInBytes, alignment);
+      return;
+    }
+  }
+}
+#endif // _LP64
+
 void Arguments::set_use_compressed_oops() {
 #ifdef _LP64
   // MaxHeapSize is not set up properly at this point, but
@@ -1434,10 +1454,16 @@ void Arguments::set_use_compressed_oops() {
       FLAG_SET_ERGO(UseCompressedOops, true);
     }
   } else {
+    // Only hint at a larger alignment if compressed oops were not turned
+    // off explicitly and the selected GC supports them.
+    const bool hint_alignment = (FLAG_IS_DEFAULT(UseCompressedOops) || UseCompressedOops) && !UseZGC;
     if (UseCompressedOops && !FLAG_IS_DEFAULT(UseCompressedOops)) {
       warning("Max heap size too large for Compressed Oops");
       FLAG_SET_DEFAULT(UseCompressedOops, false);
     }
+    if (hint_alignment) {
+      log_compressed_oops_alignment_hint(max_heap_size, OopEncodingHeapMax - max_heap_for_compressed_oops());
+    }
   }
 #endif // _LP64
 }
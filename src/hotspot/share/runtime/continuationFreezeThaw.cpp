@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -545,6 +545,11 @@ void FreezeBase::init_rest() { // we want to postpone some initialization after
   NOT_PRODUCT(_frames = 0;)
 }
 
+// Fast-locked objects stay fast-locked across unmount. The whole LockStack is
+// moved into the chunk in one go and moved back on thaw, so no monitor needs
+// to be inflated for the virtual thread to yield. Inflated monitors do not need
+// any update either, since they are owned by the virtual thread's id rather
+// than by the carrier.
 void FreezeBase::freeze_lockstack(stackChunkOop chunk) {
   assert(chunk->sp_address() - chunk->start_address() >= _monitors_in_lockstack, "no room for lockstack");
 
@@ -624,7 +629,11 @@ freeze_result Freeze<ConfigT>::try_freeze_fast() {
   DEBUG_ONLY(_fast_freeze_size = size_if_fast_freeze_available();)
   assert(_fast_freeze_size == 0, "");
 
-  stackChunkOop chunk = allocate_chunk(cont_size() + frame::metadata_words + _monitors_in_lockstack, _cont.argsize() + frame::metadata_words_at_top);
+  // The frames are frozen at the bottom of the chunk, any headroom stays free
+  // above them for later freezes into the same chunk.
+  const int size = cont_size() + frame::metadata_words + _monitors_in_lockstack;
+  const int headroom = (int)(((jlong)cont_size() * StackChunkHeadroomPercent) / 100);
+  stackChunkOop chunk = allocate_chunk(size + headroom, _cont.argsize() + frame::metadata_words_at_top);
   if (freeze_fast_new_chunk(chunk)) {
     return freeze_ok;
   }
@@ -740,8 +749,8 @@ bool FreezeBase::freeze_fast_new_chunk(stackChunkOop chunk) {
 
   // in a fresh chunk, we freeze *with* the bottom-most frame's stack arguments.
   // They'll then be stored twice: in the chunk and in the parent chunk's top frame
-  const int chunk_start_sp = cont_size() + frame::metadata_words + _monitors_in_lockstack;
-  assert(chunk_start_sp == chunk->stack_size(), "");
+  const int chunk_start_sp = chunk->stack_size();
+  assert(chunk_start_sp >= cont_size() + frame::metadata_words + _monitors_in_lockstack, "");
 
   DEBUG_ONLY(_orig_chunk_sp = chunk->start_address() + chunk_start_sp;)
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,15 @@ class compiledVFrame;
 
 template<class E> class GrowableArray;
 
+// A DeoptimizationScope marks nmethods with the active deoptimization
+// generation and deoptimize_marked() commits all generations up to the one
+// it requires with a single handshake. Concurrent scopes are thereby already
+// batched: a scope whose generation was committed by another thread returns
+// without a handshake of its own. Frames are rewritten lazily: the handshake
+// only patches the return addresses of activations of marked nmethods, and a
+// frame is converted to interpreter frames when control returns to it.
+// Marks cannot be deferred past the dependency change that caused them,
+// since code relying on a broken assumption must not be entered afterwards.
 class DeoptimizationScope {
  private:
   // What gen we have done the deopt handshake for.
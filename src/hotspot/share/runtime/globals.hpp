@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -587,6 +587,13 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
+  product(uint, NMTDetailStackSampleInterval, 1, DIAGNOSTIC,                \
+          "With NativeMemoryTracking=detail, capture the native call "      \
+          "stack for only one in this many malloc allocations per "         \
+          "thread. Mallocs that are not sampled are reported without a "    \
+          "call stack. Virtual memory is always recorded with its stack")   \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, LogCompilation, false, DIAGNOSTIC,                          \
           "Log compilation activity in detail to LogFile")                  \
                                                                             \
@@ -802,6 +809,13 @@ const int ObjectAlignmentInBytes = 8;
           "where <= 0 is unlimited, default: 65536")                        \
           range(min_intx, max_intx)                                         \
                                                                             \
+  product(uint, JNIGlobalHandleCacheSize, 0, EXPERIMENTAL,                  \
+          "Number of JNI global handle entries each Java thread keeps for " \
+          "reuse, so that creating and deleting global references does "    \
+          "not take the global handle storage lock every time. "            \
+          "0 disables the cache.")                                          \
+          range(0, 32)                                                      \
+                                                                            \
   product(bool, EagerXrunInit, false,                                       \
           "Eagerly initialize -Xrun libraries; allows startup profiling, "  \
           "but not all -Xrun libraries may support the state of the VM "    \
@@ -936,6 +950,13 @@ const int ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(uintx, CompilerThreadsAddQueueDelay, 0, EXPERIMENTAL,             \
+          "With UseDynamicNumberOfCompilerThreads, only add compiler "      \
+          "threads when the last task taken from their queue waited at "    \
+          "least this many milliseconds, and add no more threads per "      \
+          "compiler than active processors. 0 disables these limits")       \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -964,6 +985,13 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(uint, ThreadsListFreeBatchSize, 1, EXPERIMENTAL,                  \
+          "Number of replaced ThreadsLists to collect before scanning the " \
+          "hazard pointers of all threads to free them. Larger values "     \
+          "make thread start and exit cheaper with many threads, at the "   \
+          "cost of keeping more stale ThreadsLists alive")                  \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, Inline, true,                                               \
           "Enable inlining")                                                \
                                                                             \
@@ -1117,6 +1145,10 @@ const int ObjectAlignmentInBytes = 8;
           ", -1 for all")                                                   \
           range(-1, 64)                                                     \
                                                                             \
+  product(bool, ProfileStreamArguments, false, DIAGNOSTIC,                  \
+          "Also profile the argument types at invokevirtual and "           \
+          "invokeinterface call sites of java.util.stream classes")         \
+                                                                            \
   /* statistics */                                                          \
   develop(bool, CountCompiledCalls, false,                                  \
           "Count method invocations")                                       \
@@ -1736,6 +1768,10 @@ const int ObjectAlignmentInBytes = 8;
           "up to a multiple of the native os page size.")                   \
           range(128, 32*64*K)                                               \
                                                                             \
+  product(bool, PerfDataPadVariables, false, EXPERIMENTAL,                  \
+          "Pad the entries of variable long PerfData counters so that no "  \
+          "two of their values share a cache line")                         \
+                                                                            \
   product(int, PerfMaxStringConstLength, 1024,                              \
           "Maximum PerfStringConstant string length before truncation")     \
           range(32, 32*K)                                                   \
@@ -1908,6 +1944,13 @@ const int ObjectAlignmentInBytes = 8;
   product_pd(bool, VMContinuations, EXPERIMENTAL,                           \
           "Enable VM continuations support")                                \
                                                                             \
+  product(uint, StackChunkHeadroomPercent, 0, EXPERIMENTAL,                 \
+          "Extra space, as a percentage of the frozen frames, reserved in " \
+          "stack chunks allocated by the freeze fast path, so that later "  \
+          "freezes of slightly deeper stacks can reuse the chunk instead "  \
+          "of allocating a new one")                                        \
+          range(0, 100)                                                     \
+                                                                            \
   develop(bool, LoomDeoptAfterThaw, false,                                  \
           "Deopt stack after thaw")                                         \
                                                                             \
@@ -1942,6 +1985,11 @@ const int ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, nullptr,                    \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(bool, JfrThreadLocalStackTraceCache, false, EXPERIMENTAL,\
+          "Remember the last stack trace recorded by each thread so that "  \
+          "recording the same stack again does not take the global "        \
+          "stack trace repository lock"))                                   \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
@@ -1964,6 +2012,13 @@ const int ObjectAlignmentInBytes = 8;
           "With Lightweight Locking mode, use a table to record inflated "  \
           "monitors rather than the first word of the object.")             \
                                                                             \
+  product(int, OMCacheSize, 8, DIAGNOSTIC,                                  \
+          "Number of entries in the per-thread cache of recently used "     \
+          "monitors when UseObjectMonitorTable is enabled. Threads "        \
+          "locking many contended monitors miss less with a larger cache "  \
+          "but pay for a longer search in the locking fast path.")          \
+          range(1, 16)                                                      \
+                                                                            \
   product(int, LightweightFastLockingSpins, 13, DIAGNOSTIC,                 \
           "Specifies the number of times lightweight fast locking will "    \
           "attempt to CAS the markWord before inflating. Between each "     \
@@ -1971,6 +2026,11 @@ const int ObjectAlignmentInBytes = 8;
           "a total number of spins on the order of O(2^value)")             \
           range(1, 30)                                                      \
                                                                             \
+  product(bool, MonitorSpinAdmissionControl, false, EXPERIMENTAL,           \
+          "Limit the number of threads that adaptively spin on contended "  \
+          "monitors to half the active processor count at startup, and "    \
+          "do not spin in mounted virtual threads")                         \
+                                                                            \
   product(uint, TrimNativeHeapInterval, 0,                                  \
           "Interval, in ms, at which the JVM will trim the native heap if " \
           "the platform supports that. Lower values will reclaim memory "   \
@@ -1978,6 +2038,12 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(uint, TrimNativeHeapMemoryPressure, 0, EXPERIMENTAL,              \
+          "If non-zero, a periodic native heap trim is only done when "     \
+          "memory in use is at least this percentage of the (container) "   \
+          "memory limit. 0 (default) trims at every interval.")             \
+          range(0, 100)                                                     \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -245,10 +245,13 @@ class VM_HandshakeAllThreads: public VM_Operation {
   void doit() {
     jlong start_time_ns = os::javaTimeNanos();
 
+    ResourceMark rm;
     JavaThreadIteratorWithHandle jtiwh;
+    GrowableArray<JavaThread*> pending((int)jtiwh.length());
     int number_of_threads_issued = 0;
     for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
       thr->handshake_state()->add_operation(_op);
+      pending.append(thr);
       number_of_threads_issued++;
     }
 
@@ -278,17 +281,23 @@ class VM_HandshakeAllThreads: public VM_Operation {
 
       // Have VM thread perform the handshake operation for blocked threads.
       // Observing a blocked state may of course be transient but the processing is guarded
-      // by mutexes and we optimistically begin by working on the blocked threads
-      jtiwh.rewind();
-      for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
-        // A new thread on the ThreadsList will not have an operation,
-        // hence it is skipped in handshake_try_process.
+      // by mutexes and we optimistically begin by working on the blocked threads.
+      // Threads that are known to be done with the operation are dropped from
+      // the pending list, so later rounds only revisit threads still running it.
+      // The threads stay alive since jtiwh keeps the ThreadsList protected.
+      int still_pending = 0;
+      for (int i = 0; i < pending.length(); i++) {
+        JavaThread* thr = pending.at(i);
         HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
         hsy.add_result(pr);
         if (pr == HandshakeState::_succeeded) {
           emitted_handshakes_executed++;
+        } else if (pr != HandshakeState::_no_operation) {
+          // The operation may still be queued for this thread.
+          pending.at_put(still_pending++, thr);
         }
       }
+      pending.trunc_to(still_pending);
       hsy.process();
     } while (!_op->is_completed());
 
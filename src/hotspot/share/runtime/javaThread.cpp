@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2021, Azul Systems, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -430,6 +430,8 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _jni_global_handle_cache(nullptr),
+  _jni_global_handle_cache_count(0),
   _monitor_owner_id(0),
 
   _suspend_flags(0),
@@ -481,6 +483,7 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _jni_active_critical(0),
   _pending_jni_exception_check_fn(nullptr),
   _depth_first_number(0),
+  _profile_sample_seed(os::random() | 1),
 
   // JVMTI PopFrame support
   _popframe_condition(popframe_inactive),
@@ -673,6 +676,9 @@ JavaThread::~JavaThread() {
   // Enqueue OopHandles for release by the service thread.
   add_oop_handles_for_release();
 
+  // Return the cached JNI global handle entries to their storage.
+  JNIHandles::release_global_handle_cache(this);
+
   // Return the sleep event to the free list
   ParkEvent::Release(_SleepEvent);
   _SleepEvent = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2021, Azul Systems, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -163,6 +163,11 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Released JNI global handle storage entries kept for reuse,
+  // see JNIGlobalHandleCacheSize.
+  oop**           _jni_global_handle_cache;
+  uint            _jni_global_handle_cache_count;
+
   // ID used as owner for inflated monitors. Same as the j.l.Thread.tid of the
   // current _vthread object, except during creation of the primordial and JNI
   // attached thread cases where this field can have a temporary value.
@@ -209,6 +214,11 @@ class JavaThread: public Thread {
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
 
+  oop** jni_global_handle_cache() const          { return _jni_global_handle_cache; }
+  void set_jni_global_handle_cache(oop** cache)  { _jni_global_handle_cache = cache; }
+  uint jni_global_handle_cache_count() const     { return _jni_global_handle_cache_count; }
+  void set_jni_global_handle_cache_count(uint count) { _jni_global_handle_cache_count = count; }
+
   void push_jni_handle_block();
   void pop_jni_handle_block();
 
@@ -461,6 +471,10 @@ class JavaThread: public Thread {
   // For deadlock detection.
   int _depth_first_number;
 
+  // Pseudo-random state advanced by C1 profiled code to sample type
+  // profile updates, see C1TypeProfileSampleFreqLog. Never zero.
+  int _profile_sample_seed;
+
   // JVMTI PopFrame support
   // This is set to popframe_pending to signal that top Java frame should be popped immediately
   int _popframe_condition;
@@ -892,6 +906,7 @@ class JavaThread: public Thread {
     return byte_offset_of(JavaThread, _should_post_on_exceptions_flag);
   }
   static ByteSize doing_unsafe_access_offset() { return byte_offset_of(JavaThread, _doing_unsafe_access); }
+  static ByteSize profile_sample_seed_offset() { return byte_offset_of(JavaThread, _profile_sample_seed); }
   NOT_PRODUCT(static ByteSize requires_cross_modify_fence_offset()  { return byte_offset_of(JavaThread, _requires_cross_modify_fence); })
 
   static ByteSize monitor_owner_id_offset()   { return byte_offset_of(JavaThread, _monitor_owner_id); }
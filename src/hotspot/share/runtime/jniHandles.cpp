@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/align.hpp"
+#include "utilities/checkedCast.hpp"
 #include "utilities/debug.hpp"
 
 OopStorage* JNIHandles::global_handles() {
@@ -81,6 +82,62 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+// Cached entries stay allocated in the storage while they hold null, like
+// entries of deleted global handles that are about to be released, so GC and
+// iteration see nothing new. A deleted handle whose entry is cached still
+// reports as a global handle, but using a deleted handle is undefined anyway.
+oop* JNIHandles::allocate_global_entry() {
+  Thread* current = Thread::current();
+  if (JNIGlobalHandleCacheSize == 0 || !current->is_Java_thread()) {
+    return global_handles()->allocate();
+  }
+
+  JavaThread* thread = JavaThread::cast(current);
+  oop** cache = thread->jni_global_handle_cache();
+  uint count = thread->jni_global_handle_cache_count();
+  if (count == 0) {
+    if (cache == nullptr) {
+      cache = NEW_C_HEAP_ARRAY(oop*, JNIGlobalHandleCacheSize, mtInternal);
+      thread->set_jni_global_handle_cache(cache);
+    }
+    // One bulk allocation takes the storage lock once for the whole cache.
+    count = checked_cast<uint>(global_handles()->allocate(cache, JNIGlobalHandleCacheSize));
+    if (count == 0) {
+      return nullptr;
+    }
+  }
+  thread->set_jni_global_handle_cache_count(count - 1);
+  return cache[count - 1];
+}
+
+void JNIHandles::release_global_entry(oop* ptr) {
+  Thread* current = Thread::current();
+  if (JNIGlobalHandleCacheSize > 0 && current->is_Java_thread()) {
+    JavaThread* thread = JavaThread::cast(current);
+    oop** cache = thread->jni_global_handle_cache();
+    uint count = thread->jni_global_handle_cache_count();
+    if (cache != nullptr && count < JNIGlobalHandleCacheSize) {
+      cache[count] = ptr;
+      thread->set_jni_global_handle_cache_count(count + 1);
+      return;
+    }
+  }
+  global_handles()->release(ptr);
+}
+
+void JNIHandles::release_global_handle_cache(JavaThread* thread) {
+  oop** cache = thread->jni_global_handle_cache();
+  if (cache != nullptr) {
+    uint count = thread->jni_global_handle_cache_count();
+    if (count > 0) {
+      global_handles()->release(cache, count);
+    }
+    thread->set_jni_global_handle_cache(nullptr);
+    thread->set_jni_global_handle_cache_count(0);
+    FREE_C_HEAP_ARRAY(oop*, cache);
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_stw_gc_active(), "can't extend the root set during GC pause");
   assert(!current_thread_in_native(), "must not be in native");
@@ -88,7 +145,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_global_entry();
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -147,7 +204,7 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
-    global_handles()->release(oop_ptr);
+    release_global_entry(oop_ptr);
   }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,6 +61,11 @@ class JNIHandles : AllStatic {
   // this header file and thread.hpp.
   static bool current_thread_in_native();
 
+  // Allocate and release global handle storage entries, going through the
+  // cache of the current thread with JNIGlobalHandleCacheSize.
+  static oop* allocate_global_entry();
+  static void release_global_entry(oop* ptr);
+
  public:
   // Low tag bits in jobject used to distinguish its type. Checking
   // the underlying storage type is unsuitable for performance reasons.
@@ -101,6 +106,8 @@ class JNIHandles : AllStatic {
   static jobject make_global(Handle  obj,
                              AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void destroy_global(jobject handle);
+  // Return the global handle storage entries cached by thread.
+  static void release_global_handle_cache(JavaThread* thread);
 
   // Weak global handles
   static jweak make_weak_global(Handle obj,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -71,6 +71,10 @@ class ObjectMonitorTable : AllStatic {
   static size_t _table_size;
   static volatile bool _resize;
 
+  // Thread-local cache statistics, only collected when logging is enabled.
+  static volatile size_t _cache_hits;
+  static volatile size_t _cache_misses;
+
   class Lookup : public StackObj {
     oop _obj;
 
@@ -182,6 +186,19 @@ class ObjectMonitorTable : AllStatic {
 #endif
   }
 
+  static void record_cache_lookup(bool hit) {
+    if (log_is_enabled(Info, monitortable)) {
+      Atomic::inc(hit ? &_cache_hits : &_cache_misses, memory_order_relaxed);
+    }
+  }
+
+  static void log_cache_statistics() {
+    const size_t hits = Atomic::load(&_cache_hits);
+    const size_t misses = Atomic::load(&_cache_misses);
+    log_info(monitortable)("Cache hits: %zu, misses: %zu (%.1f%% hit rate)",
+                           hits, misses, percent_of(hits, hits + misses));
+  }
+
   static ObjectMonitor* monitor_get(Thread* current, oop obj) {
     ObjectMonitor* result = nullptr;
     Lookup lookup_f(obj);
@@ -274,6 +291,8 @@ class ObjectMonitorTable : AllStatic {
 
     Atomic::store(&_resize, false);
 
+    log_cache_statistics();
+
     return success;
   }
 
@@ -331,6 +350,8 @@ ObjectMonitorTable::ConcurrentTable* ObjectMonitorTable::_table = nullptr;
 volatile size_t ObjectMonitorTable::_items_count = 0;
 size_t ObjectMonitorTable::_table_size = 0;
 volatile bool ObjectMonitorTable::_resize = false;
+volatile size_t ObjectMonitorTable::_cache_hits = 0;
+volatile size_t ObjectMonitorTable::_cache_misses = 0;
 
 ObjectMonitor* LightweightSynchronizer::get_or_insert_monitor_from_table(oop object, JavaThread* current, bool* inserted) {
   assert(LockingMode == LM_LIGHTWEIGHT, "must be");
@@ -545,6 +566,7 @@ inline static ObjectMonitor* read_caches(JavaThread* current, BasicLock* lock, o
   if (monitor == nullptr) {
     monitor = current->om_get_from_monitor_cache(object);
   }
+  ObjectMonitorTable::record_cache_lookup(monitor != nullptr);
   return monitor;
 }
 
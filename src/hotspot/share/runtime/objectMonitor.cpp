@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,7 @@
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safefetch.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
@@ -2291,6 +2292,54 @@ inline static int adjust_down(int spin_duration) {
   }
 }
 
+// Admission control for the adaptive spin (MonitorSpinAdmissionControl).
+// The per-monitor _SpinDuration only reflects the hold times of that monitor.
+// When more threads spin than there are CPUs available to the process,
+// spinners mostly burn CPU time that the owners need to make progress. So we
+// cap the number of concurrent spinners relative to the active processor
+// count. A mounted virtual thread does not spin at all, blocking unmounts it
+// and lets its carrier run other virtual threads instead.
+//
+// The cap is computed once in Initialize(), so that try_spin() does not query
+// the processor count, which may read the cgroup files, on every contended
+// enter. It reflects the cgroup CPU quota at startup only; a later change of
+// the quota is not picked up.
+//
+// _spinner_count is shared by all monitors, so its cache line moves between
+// the CPUs of contending threads. It is only updated once when a thread
+// starts and once when it stops spinning, not per spin iteration, but on
+// machines with many CPUs that is still an extra contended atomic on each
+// spinning enter, which is part of why this is not on by default.
+static volatile int _spinner_count = 0;
+static int _max_spinners = 1;
+
+class SpinAdmission : public StackObj {
+  bool _admitted;
+
+ public:
+  SpinAdmission(JavaThread* current) : _admitted(true) {
+    if (!MonitorSpinAdmissionControl) {
+      return;
+    }
+    if (current->is_vthread_mounted()) {
+      _admitted = false;
+      return;
+    }
+    if (Atomic::add(&_spinner_count, 1) > _max_spinners) {
+      Atomic::dec(&_spinner_count);
+      _admitted = false;
+    }
+  }
+
+  ~SpinAdmission() {
+    if (MonitorSpinAdmissionControl && _admitted) {
+      Atomic::dec(&_spinner_count);
+    }
+  }
+
+  bool admitted() const { return _admitted; }
+};
+
 bool ObjectMonitor::short_fixed_spin(JavaThread* current, int spin_count, bool adapt) {
   for (int ctr = 0; ctr < spin_count; ctr++) {
     TryLockResult status = try_lock(current);
@@ -2339,6 +2388,11 @@ bool ObjectMonitor::try_spin(JavaThread* current) {
   int ctr = _SpinDuration;
   if (ctr <= 0) return false;
 
+  SpinAdmission admission(current);
+  if (!admission.admitted()) {
+    return false;
+  }
+
   // We're good to spin ... spin ingress.
   // CONSIDER: use Prefetch::write() to avoid RTS->RTO upgrades
   // when preparing to LD...CAS _owner, etc and the CAS is likely
@@ -2559,6 +2613,10 @@ void ObjectMonitor::Initialize() {
     Knob_FixedSpin = -1;
   }
 
+  if (MonitorSpinAdmissionControl) {
+    _max_spinners = MAX2(os::active_processor_count() / 2, 1);
+  }
+
   _oop_storage = OopStorageSet::create_weak("ObjectSynchronizer Weak", mtSynchronizer);
 
   DEBUG_ONLY(InitDone = true;)
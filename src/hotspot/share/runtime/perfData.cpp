@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -138,6 +138,18 @@ void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
   // align size to assure allocation in units of 8 bytes
   int align = sizeof(jlong) - 1;
   size = ((size + align) & ~align);
+
+  // Variable scalar longs end with their value. Making each of them at least
+  // a cache line plus the value long keeps any two values on different lines.
+  if (PerfDataPadVariables && dtype == T_LONG && vlen == 0 && variability() != V_Constant) {
+    size_t min_size = DEFAULT_CACHE_LINE_SIZE + dsize;
+    if (size < min_size) {
+      size_t extra = min_size - size;
+      pad_length += extra;
+      data_start += extra;
+      size += extra;
+    }
+  }
   char* psmp = PerfMemory::alloc(size);
 
   if (psmp == nullptr) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -232,6 +232,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
 
+  // Remember the thread that was the last to stop, it is the one that
+  // determined the time-to-safepoint of this operation.
+  JavaThread* last_to_stop = nullptr;
+
   do {
     // Check if this has taken too long:
     if (SafepointTimeout && safepoint_limit_time < os::javaTimeNanos()) {
@@ -244,6 +248,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        last_to_stop = cur_tss->thread();
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -266,6 +271,14 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
 
   assert(tss_head == nullptr, "Must be empty");
 
+  if (log_is_enabled(Debug, safepoint)) {
+    ResourceMark rm;
+    log_debug(safepoint)("Last thread to reach safepoint: \"%s\" " PTR_FORMAT
+                         " after " JLONG_FORMAT " ns, %d iterations",
+                         last_to_stop->name(), p2i(last_to_stop),
+                         (jlong)(os::javaTimeNanos() - SafepointTracing::start_of_safepoint()), iterations);
+  }
+
   return iterations;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1854,6 +1854,15 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   log.end(deflated_count, unlinked_count);
 
+  if (deflated_count >= (size_t)MonitorDeflationMax) {
+    // This cycle was cut short by MonitorDeflationMax, so more idle monitors
+    // are likely left on the in-use list. Run the next cycle right away
+    // instead of waiting for the deflation interval, so that the memory of
+    // a contention spike is reclaimed in consecutive bounded cycles.
+    log_info(monitorinflation)("Reached MonitorDeflationMax, requesting another deflation cycle");
+    set_is_async_deflation_requested(true);
+  }
+
   GVars.stw_random = os::random();
 
   if (deflated_count != 0) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -137,6 +137,10 @@ uint                  ThreadsSMRSupport::_to_delete_list_cnt = 0;
 // Impl note: See _to_delete_list_cnt note.
 uint                  ThreadsSMRSupport::_to_delete_list_max = 0;
 
+// # of ThreadsLists added to the to-delete list since the last hazard ptr
+// scan. See ThreadsListFreeBatchSize.
+uint                  ThreadsSMRSupport::_to_delete_list_unscanned_cnt = 0;
+
 // 'inline' functions first so the definitions are before first use:
 
 inline void ThreadsSMRSupport::add_deleted_thread_times(uint add_value) {
@@ -909,6 +913,14 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     }
   }
 
+  if (++_to_delete_list_unscanned_cnt < ThreadsListFreeBatchSize) {
+    // Batch up the hazard ptr scans, the ThreadsList will be freed by a
+    // later call.
+    log_debug(thread, smr)("tid=%zu: ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is deferred.", os::current_thread_id(), p2i(threads));
+    return;
+  }
+  _to_delete_list_unscanned_cnt = 0;
+
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
   ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
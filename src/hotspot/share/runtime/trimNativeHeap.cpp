@@ -1,7 +1,7 @@
 /*
  * Copyright (c) 2023 SAP SE. All rights reserved.
  * Copyright (c) 2023 Red Hat Inc. All rights reserved.
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -127,8 +127,28 @@ class NativeHeapTrimmerThread : public NamedThread {
       log_trace(trimnative)("Times: %u suspended, %u timed, %u safepoint",
                             times_suspended, times_waited, times_safepoint);
 
-      execute_trim_and_log(tnow);
+      if (under_memory_pressure()) {
+        execute_trim_and_log(tnow);
+      }
+    }
+  }
+
+  // Returns true if a periodic trim should be done now. With
+  // TrimNativeHeapMemoryPressure set, trimming is skipped while the memory
+  // in use is below that percentage of the, possibly container, limit.
+  bool under_memory_pressure() const {
+    if (TrimNativeHeapMemoryPressure == 0) {
+      return true;
+    }
+    const julong limit = os::physical_memory();
+    const julong avail = MIN2(os::available_memory(), limit);
+    const julong used_percent = limit > 0 ? ((limit - avail) * 100) / limit : 100;
+    if (used_percent < TrimNativeHeapMemoryPressure) {
+      log_trace(trimnative)("Trim skipped, memory in use %u%% below %u%%",
+                            (unsigned)used_percent, TrimNativeHeapMemoryPressure);
+      return false;
     }
+    return true;
   }
 
   // Execute the native trim, log results.
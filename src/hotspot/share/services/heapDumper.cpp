@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2023, Alibaba Group Holding Limited. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -2155,11 +2155,21 @@ void DumpMerger::merge_file(const char* path) {
     return;
   }
 
+  // Try copy_file_range first, which allows the file system to share extents
+  // instead of copying the data. If it is not supported, or stops making
+  // progress, continue with sendfile from where it left off. Both advance the
+  // file offset of the global writer.
+  jlong offset = 0;
+  while (offset < st.st_size) {
+    if (os::Linux::copy_file_range(segment_fd, &offset, _writer->get_fd(), st.st_size - offset) <= 0) {
+      break;
+    }
+  }
+
   // A successful call to sendfile may write fewer bytes than requested; the
   // caller should be prepared to retry the call if there were unsent bytes.
-  jlong offset = 0;
   while (offset < st.st_size) {
-    int ret = os::Linux::sendfile(_writer->get_fd(), segment_fd, &offset, st.st_size);
+    jlong ret = os::Linux::sendfile(_writer->get_fd(), segment_fd, &offset, st.st_size - offset);
     if (ret == -1) {
       ::close(segment_fd);
       set_error("Failed to merge segmented heap file");
@@ -2243,6 +2253,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   volatile int            _frame_serial_num;
 
   volatile int            _dump_seq;
+  // heap dump segments are written to the global writer, no segment files
+  bool                    _direct_dump;
   // parallel heap dump support
   uint                    _num_dumper_threads;
   DumperController*       _dumper_controller;
@@ -2272,7 +2284,7 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   void dump_stack_traces(AbstractDumpWriter* writer);
 
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads, bool direct_dump) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -2288,6 +2300,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
     _frame_serial_num = 1;
 
     _dump_seq = VMDumperId;
+    _direct_dump = direct_dump;
+    assert(!direct_dump || num_dump_threads == 1, "direct dump must be serial");
     _num_dumper_threads = num_dump_threads;
     _dumper_controller = nullptr;
     _poi = nullptr;
@@ -2319,7 +2333,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
     }
     delete _klass_map;
   }
-  int dump_seq()           { return _dump_seq; }
+  // number of segment files to merge
+  int dump_seq()           { return _direct_dump ? 0 : _dump_seq; }
   bool is_parallel_dump()  { return _num_dumper_threads > 1; }
   void prepare_parallel_dump(WorkerThreads* workers);
 
@@ -2477,21 +2492,25 @@ void VM_HeapDumper::work(uint worker_id) {
 
   ResourceMark rm;
   // share global compressor, local DumpWriter is not responsible for its life cycle
-  DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
-                            writer()->is_overwrite(), writer()->compressor());
-  if (!segment_writer.has_error()) {
+  DumpWriter* local_writer = nullptr;
+  if (!_direct_dump) {
+    local_writer = new DumpWriter(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
+                                  writer()->is_overwrite(), writer()->compressor());
+  }
+  DumpWriter* segment_writer = _direct_dump ? writer() : local_writer;
+  if (!segment_writer->has_error()) {
     if (is_vm_dumper(dumper_id)) {
       // dump some non-heap subrecords to heap dump segment
       TraceTime timer("Dump non-objects (part 2)", TRACETIME_LOG(Info, heapdump));
       // Writes HPROF_GC_CLASS_DUMP records
-      ClassDumper class_dumper(&segment_writer);
+      ClassDumper class_dumper(segment_writer);
       ClassLoaderDataGraph::classes_do(&class_dumper);
 
       // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
-      dump_threads(&segment_writer);
+      dump_threads(segment_writer);
 
       // HPROF_GC_ROOT_JNI_GLOBAL
-      JNIGlobalsDumper jni_dumper(&segment_writer);
+      JNIGlobalsDumper jni_dumper(segment_writer);
       JNIHandles::oops_do(&jni_dumper);
       // technically not jni roots, but global roots
       // for things like preallocated throwable backtraces
@@ -2499,7 +2518,7 @@ void VM_HeapDumper::work(uint worker_id) {
       // HPROF_GC_ROOT_STICKY_CLASS
       // These should be classes in the null class loader data, and not all classes
       // if !ClassUnloading
-      StickyClassDumper stiky_class_dumper(&segment_writer);
+      StickyClassDumper stiky_class_dumper(segment_writer);
       ClassLoaderData::the_null_class_loader_data()->classes_do(&stiky_class_dumper);
     }
 
@@ -2512,7 +2531,7 @@ void VM_HeapDumper::work(uint worker_id) {
     // of the heap dump.
 
     TraceTime timer(is_parallel_dump() ? "Dump heap objects in parallel" : "Dump heap objects", TRACETIME_LOG(Info, heapdump));
-    HeapObjectDumper obj_dumper(&segment_writer, this);
+    HeapObjectDumper obj_dumper(segment_writer, this);
     if (!is_parallel_dump()) {
       Universe::heap()->object_iterate(&obj_dumper);
     } else {
@@ -2520,11 +2539,12 @@ void VM_HeapDumper::work(uint worker_id) {
       _poi->object_iterate(&obj_dumper, worker_id);
     }
 
-    segment_writer.finish_dump_segment();
-    segment_writer.flush();
+    segment_writer->finish_dump_segment();
+    segment_writer->flush();
   }
 
-  _dumper_controller->dumper_complete(&segment_writer, writer());
+  _dumper_controller->dumper_complete(segment_writer, writer());
+  delete local_writer;
 
   if (is_vm_dumper(dumper_id)) {
     _dumper_controller->wait_all_dumpers_complete();
@@ -2587,6 +2607,10 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
   thread_dumper.init_serial_nums(&_thread_serial_num, &_frame_serial_num);
 
   // write HPROF_TRACE/HPROF_FRAME records to global writer
+  if (segment_writer == writer()) {
+    // top-level records must not end up inside the current dump segment
+    segment_writer->finish_dump_segment();
+  }
   _dumper_controller->lock_global_writer();
   thread_dumper.dump_stack_traces(writer(), _klass_map);
   _dumper_controller->unlock_global_writer();
@@ -2618,6 +2642,27 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     }
   }
 
+  // A named pipe can not be followed by merging segment files that would
+  // have to be written next to it, so dump serially and write all segments
+  // through the global writer, which then blocks on the reader. The FIFO
+  // already exists, so it is only opened with overwrite; without it the
+  // exclusive create fails. Unix domain sockets can not be open()ed at all
+  // and are not supported; a socat/ncat process on a FIFO can forward the
+  // stream. Note that the whole stream is written inside the safepoint, so
+  // a reader that stalls also stalls the VM until it drains the pipe.
+  struct stat st;
+  const bool direct_dump = os::stat(path, &st) == 0 && S_ISFIFO(st.st_mode);
+  if (direct_dump) {
+    if (!overwrite) {
+      set_error("Dumping to a named pipe requires overwrite");
+      if (out != nullptr) {
+        out->print_cr("Unable to create %s: %s", path, error());
+      }
+      return -1;
+    }
+    num_dump_threads = 1;
+  }
+
   // create JFR event
   EventHeapDump event;
 
@@ -2644,7 +2689,7 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   }
 
   // generate the segmented heap dump into separate files
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads, direct_dump);
   VMThread::execute(&dumper);
 
   // record any error that the writer may have encountered
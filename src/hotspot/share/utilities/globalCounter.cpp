@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,14 +29,33 @@
 #include "runtime/vmThread.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/spinYield.hpp"
+#include "utilities/systemMemoryBarrier.hpp"
 
 GlobalCounter::PaddedCounter GlobalCounter::_global_counter;
+GlobalCounter::PaddedCounter GlobalCounter::_completed_counter;
+
+// True if version is not newer than completed, taking wrap-around into account.
+static bool is_version_completed(uintx completed, uintx version) {
+  return (completed - version) <= (max_uintx / 2);
+}
 
 class GlobalCounter::CounterThreadCheck : public ThreadClosure {
  private:
   uintx _gbl_cnt;
+  bool _covered;
  public:
-  CounterThreadCheck(uintx gbl_cnt) : _gbl_cnt(gbl_cnt) {}
+  CounterThreadCheck(uintx gbl_cnt) : _gbl_cnt(gbl_cnt), _covered(false) {}
+
+  // True once another writer has completed a grace period for a version at
+  // least as new as ours. That scan started after our increment, and so also
+  // waited for all of our pre-existing readers.
+  bool is_covered() {
+    if (!_covered) {
+      _covered = is_version_completed(Atomic::load_acquire(&_completed_counter._counter), _gbl_cnt);
+    }
+    return _covered;
+  }
+
   void do_thread(Thread* thread) {
     SpinYield yield;
     // Loops on this thread until it has exited the critical read section.
@@ -48,6 +67,9 @@ class GlobalCounter::CounterThreadCheck : public ThreadClosure {
       // generation. If the counter is larger than the global counter version this
       //  is a new reader and we can continue.
       if (((cnt & COUNTER_ACTIVE) != 0) && (cnt - _gbl_cnt) > (max_uintx / 2)) {
+        if (is_covered()) {
+          break;
+        }
         yield.wait();
       } else {
         break;
@@ -60,13 +82,35 @@ void GlobalCounter::write_synchronize() {
   assert((*Thread::current()->get_rcu_counter() & COUNTER_ACTIVE) == 0x0, "must be outside a critcal section");
   // Atomic::add must provide fence since we have storeload dependency.
   uintx gbl_cnt = Atomic::add(&_global_counter._counter, COUNTER_INCREMENT);
+  if (UseSystemMemoryBarrier) {
+    // Readers enter critical sections without a fence, make their
+    // counter stores visible before checking them.
+    SystemMemoryBarrier::emit();
+  }
 
-  // Do all RCU threads.
+  // Do all RCU threads, unless a concurrent writer completes a grace period
+  // covering ours first.
   CounterThreadCheck ctc(gbl_cnt);
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *thread = jtiwh.next(); ) {
+    if (ctc.is_covered()) {
+      return;
+    }
     ctc.do_thread(thread);
   }
   for (NonJavaThread::Iterator njti; !njti.end(); njti.step()) {
+    if (ctc.is_covered()) {
+      return;
+    }
     ctc.do_thread(njti.current());
   }
+
+  // Publish the completed grace period for writers waiting on older versions.
+  uintx completed = Atomic::load(&_completed_counter._counter);
+  while (!is_version_completed(completed, gbl_cnt)) {
+    uintx prev = Atomic::cmpxchg(&_completed_counter._counter, completed, gbl_cnt);
+    if (prev == completed) {
+      break;
+    }
+    completed = prev;
+  }
 }
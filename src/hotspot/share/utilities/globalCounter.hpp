@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,9 +38,10 @@ class Thread;
 // before reclaming the memory. The read-path only does an uncontended store
 // to a thread-local-storage and fence to stop any loads from floating up, thus
 // light weight and wait-free. The write-side is more heavy since it must check
-// all readers and wait until they have left the generation. (a system memory
-// barrier can be used on write-side to remove fence in read-side,
-// not implemented).
+// all readers and wait until they have left the generation. With
+// UseSystemMemoryBarrier the write-side emits a system memory barrier instead
+// of the read-side fence. Concurrent writers share grace periods: a writer
+// returns early once another writer has completed a scan that covers it.
 class GlobalCounter : public AllStatic {
  private:
   // Since do not know what we will end up next to in BSS, we make sure the
@@ -53,6 +54,8 @@ class GlobalCounter : public AllStatic {
 
   // The global counter
   static PaddedCounter _global_counter;
+  // The highest global counter version whose grace period has completed
+  static PaddedCounter _completed_counter;
 
   // Bit 0 is active bit.
   static const uintx COUNTER_ACTIVE = 1;
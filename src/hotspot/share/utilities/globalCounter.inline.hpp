@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #include "utilities/globalCounter.hpp"
 
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/javaThread.hpp"
 
 inline GlobalCounter::CSContext
@@ -37,10 +38,24 @@ GlobalCounter::critical_section_begin(Thread *thread) {
   // Retain the old counter value if already active, e.g. nested.
   // Otherwise, set the counter to the current version + active bit.
   uintx new_cnt = old_cnt;
-  if ((new_cnt & COUNTER_ACTIVE) == 0) {
-    new_cnt = Atomic::load(&_global_counter._counter) | COUNTER_ACTIVE;
+  // With a system memory barrier the writer serializes all threads once it
+  // has published the new version, so the reader needs no StoreLoad fence
+  // after storing its counter. The reader must still not load the protected
+  // data before the version it records, or it could hold an old pointer while
+  // recording the new version, which write_synchronize() would not wait for.
+  // Without the fence that ordering comes from the acquire of the version,
+  // which pairs with the fence of the writer's increment.
+  if (UseSystemMemoryBarrier) {
+    if ((new_cnt & COUNTER_ACTIVE) == 0) {
+      new_cnt = Atomic::load_acquire(&_global_counter._counter) | COUNTER_ACTIVE;
+    }
+    Atomic::release_store(thread->get_rcu_counter(), new_cnt);
+  } else {
+    if ((new_cnt & COUNTER_ACTIVE) == 0) {
+      new_cnt = Atomic::load(&_global_counter._counter) | COUNTER_ACTIVE;
+    }
+    Atomic::release_store_fence(thread->get_rcu_counter(), new_cnt);
   }
-  Atomic::release_store_fence(thread->get_rcu_counter(), new_cnt);
   return static_cast<CSContext>(old_cnt);
 }
 
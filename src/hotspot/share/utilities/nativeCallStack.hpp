@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -117,10 +117,13 @@ class NativeCallStack : public StackObj {
   // Helper; calculates a hash value over the stack frames in this stack
   unsigned int calculate_hash() const {
     DEBUG_ONLY(assert_not_fake();)
+    // Order-sensitive, so that stacks made of the same frames in a different
+    // order do not collide, and fold the high bits into the 32-bit result.
     uintptr_t hash = 0;
     for (int i = 0; i < NMT_TrackingStackDepth; i++) {
-      hash += (uintptr_t)_stack[i];
+      hash = hash * 31 + (uintptr_t)_stack[i];
     }
+    LP64_ONLY(hash ^= hash >> 32;)
     return (unsigned int)hash;
   }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -21,6 +21,7 @@
  * questions.
  */
 
+#include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "threadHelper.inline.hpp"
@@ -193,3 +194,19 @@ TEST_VM(SymbolTable, test_cleanup_delay_drain) {
     ASSERT_EQ(symbols[i]->refcount(), 1) << "TempNewSymbol refcount after drain is 1";
   }
 }
+
+TEST(SymbolTable, hash_code_matches_reference) {
+  // The unrolled byte hash must agree with the plain 31*h + c recurrence,
+  // since it also hashes the symbols in the CDS archive.
+  jbyte bytes[64];
+  for (int i = 0; i < (int)sizeof(bytes); i++) {
+    bytes[i] = (jbyte)(i * 37 + 0x80);
+  }
+  for (int len = 0; len <= (int)sizeof(bytes); len++) {
+    unsigned int expected = 0;
+    for (int i = 0; i < len; i++) {
+      expected = 31 * expected + (((unsigned int) bytes[i]) & 0xFF);
+    }
+    ASSERT_EQ(expected, java_lang_String::hash_code(bytes, len)) << "length " << len;
+  }
+}
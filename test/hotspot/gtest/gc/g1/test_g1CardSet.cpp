@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -77,6 +77,7 @@ class G1CardSetTest : public ::testing::Test {
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_adaptive_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -478,6 +479,58 @@ void G1CardSetTest::cardset_mt_test() {
   ASSERT_TRUE(count_cards._num_cards <= cl.added());
 }
 
+void G1CardSetTest::cardset_adaptive_test() {
+  const uint CardsPerRegion = 2048;
+
+  G1CardSetConfiguration config(28,
+                                0.9,
+                                8,
+                                0.8,
+                                CardsPerRegion,
+                                0);
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set(&config, &mm);
+
+  uint const cards_to_howl = config.max_cards_in_array() + 1;
+  uint const cards_to_array = config.max_cards_in_inline_ptr() + 1;
+
+  // A sparse container is coarsened to Array of Cards at first.
+  for (uint i = 0; i < cards_to_array; i++) {
+    card_set.add_card(0, i);
+  }
+  ASSERT_EQ(G1CardSet::ContainerArrayOfCards,
+            G1CardSet::container_type(card_set.get_container(0)->_container));
+
+  // Make the containers of the card set regularly coarsen to Howl.
+  uint region = 1;
+  for (; region <= G1CardSet::MinCoarsenSamples; region++) {
+    for (uint i = 0; i < cards_to_howl; i++) {
+      card_set.add_card(region, i);
+    }
+    ASSERT_EQ(G1CardSet::ContainerHowl,
+              G1CardSet::container_type(card_set.get_container(region)->_container));
+  }
+
+  // New containers skip Array of Cards now.
+  for (uint i = 0; i < cards_to_array; i++) {
+    card_set.add_card(region, i);
+  }
+  ASSERT_EQ(G1CardSet::ContainerHowl,
+            G1CardSet::container_type(card_set.get_container(region)->_container));
+  ASSERT_TRUE(card_set.occupied() == cards_to_array * 2 + G1CardSet::MinCoarsenSamples * cards_to_howl);
+  check_iteration(&card_set, card_set.occupied());
+
+  // The observed density is kept after clearing the card set.
+  card_set.clear();
+  for (uint i = 0; i < cards_to_array; i++) {
+    card_set.add_card(0, i);
+  }
+  ASSERT_EQ(G1CardSet::ContainerHowl,
+            G1CardSet::container_type(card_set.get_container(0)->_container));
+}
+
 TEST_VM(G1CardSetTest, basic_cardset_test) {
   G1CardSetTest::cardset_basic_test();
 }
@@ -485,3 +538,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, adaptive_cardset_test) {
+  G1CardSetTest::cardset_adaptive_test();
+}
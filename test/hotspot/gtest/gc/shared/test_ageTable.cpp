@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "gc/shared/ageTable.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "runtime/globals_extension.hpp"
+#include "utilities/autoRestore.hpp"
+#include "unittest.hpp"
+
+// Large enough that the size based threshold is MaxTenuringThreshold.
+static const size_t desired_survivor_size = 1 * M;
+
+class AgeTableSurvivalRateTest : public ::testing::Test {
+ protected:
+  AutoSaveRestore<bool> _always_tenure;
+  AutoSaveRestore<bool> _never_tenure;
+  AutoSaveRestore<uint> _max_tenuring_threshold;
+  AutoSaveRestore<uint> _survival_rate_percent;
+
+  AgeTableSurvivalRateTest() :
+    _always_tenure(AlwaysTenure),
+    _never_tenure(NeverTenure),
+    _max_tenuring_threshold(MaxTenuringThreshold),
+    _survival_rate_percent(TenuringSurvivalRatePercent) {
+    FLAG_SET_CMDLINE(AlwaysTenure, false);
+    FLAG_SET_CMDLINE(NeverTenure, false);
+    FLAG_SET_CMDLINE(TenuringSurvivalRatePercent, 50);
+  }
+
+  // Replace the contents of the table with sizes[age] for age >= 1.
+  static void fill(AgeTable* table, const size_t* sizes, uint length) {
+    table->clear();
+    for (uint age = 1; age < length; age++) {
+      table->add(age, sizes[age]);
+    }
+  }
+};
+
+TEST_VM_F(AgeTableSurvivalRateTest, lowers_threshold) {
+  FLAG_SET_CMDLINE(MaxTenuringThreshold, 15u);
+  AgeTable table(false);
+
+  const size_t first[] = { 0, 1000, 100, 100, 100, 100 };
+  fill(&table, first, ARRAY_SIZE(first));
+  // Nothing to compare with yet.
+  ASSERT_EQ(15u, table.compute_tenuring_threshold(desired_survivor_size));
+
+  // Nothing of age 1 survived, everything older did, one age older.
+  const size_t second[] = { 0, 1000, 0, 100, 100, 100, 100 };
+  fill(&table, second, ARRAY_SIZE(second));
+  // 400 of 400 words of previous age 2 and above survived, 400 of
+  // 1400 words of previous age 1 and above.
+  ASSERT_EQ(2u, table.compute_tenuring_threshold(desired_survivor_size));
+}
+
+TEST_VM_F(AgeTableSurvivalRateTest, keeps_threshold) {
+  FLAG_SET_CMDLINE(MaxTenuringThreshold, 15u);
+  AgeTable table(false);
+
+  const size_t first[] = { 0, 1000, 100, 100 };
+  fill(&table, first, ARRAY_SIZE(first));
+  ASSERT_EQ(15u, table.compute_tenuring_threshold(desired_survivor_size));
+
+  // Only a small fraction of each cohort survived.
+  const size_t second[] = { 0, 1000, 100, 10, 10 };
+  fill(&table, second, ARRAY_SIZE(second));
+  ASSERT_EQ(15u, table.compute_tenuring_threshold(desired_survivor_size));
+}
+
+TEST_VM_F(AgeTableSurvivalRateTest, counts_oldest_cohort) {
+  FLAG_SET_CMDLINE(MaxTenuringThreshold, 3u);
+  AgeTable table(false);
+
+  const size_t first[] = { 0, 1000, 100 };
+  fill(&table, first, ARRAY_SIZE(first));
+  ASSERT_EQ(3u, table.compute_tenuring_threshold(desired_survivor_size));
+
+  // The survivors of previous age 2 now have the age of the previous
+  // threshold, 3, and must be compared with previous age 2.
+  const size_t second[] = { 0, 1000, 0, 100 };
+  fill(&table, second, ARRAY_SIZE(second));
+  ASSERT_EQ(2u, table.compute_tenuring_threshold(desired_survivor_size));
+}
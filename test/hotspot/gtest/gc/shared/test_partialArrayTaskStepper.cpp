@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,13 @@ class PartialArrayTaskStepper::TestSupport : AllStatic {
                    size_t* to_length_addr) {
     return stepper->next_impl(length, to_length_addr);
   }
+
+  static Step next(const Stepper* stepper,
+                   size_t length,
+                   size_t* to_length_addr,
+                   size_t chunk_size) {
+    return stepper->next_impl(length, to_length_addr, chunk_size);
+  }
 };
 
 using StepperSupport = PartialArrayTaskStepper::TestSupport;
@@ -76,3 +83,34 @@ TEST(PartialArrayTaskStepperTest, doit) {
     }
   }
 }
+
+static uint simulate_with_chunk_size(const Stepper* stepper,
+                                     size_t length,
+                                     size_t chunk_size,
+                                     size_t* to_length_addr) {
+  Step init = stepper->start(length, chunk_size);
+  *to_length_addr = init._index;
+  uint queue_count = init._ncreate;
+  uint task = 0;
+  for ( ; queue_count > 0; ++task) {
+    --queue_count;
+    Step step = StepperSupport::next(stepper, length, to_length_addr, chunk_size);
+    queue_count += step._ncreate;
+  }
+  return task;
+}
+
+TEST(PartialArrayTaskStepperTest, explicit_chunk_size) {
+  const size_t default_chunk_size = 50;
+  for (size_t chunk_size = 1; chunk_size <= 800; chunk_size *= 2) {
+    for (uint n_workers = 1; n_workers <= 256; n_workers = (n_workers * 3 / 2 + 1)) {
+      const PartialArrayTaskStepper stepper(n_workers, default_chunk_size);
+      for (size_t length = 0; length <= 100000; length = (length * 2 + 1)) {
+        size_t to_length;
+        uint tasks = simulate_with_chunk_size(&stepper, length, chunk_size, &to_length);
+        ASSERT_EQ(length, to_length);
+        ASSERT_EQ(tasks, length / chunk_size);
+      }
+    }
+  }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -135,6 +135,7 @@ class ZForwardingTest : public Test {
 
   static void setup(ZForwarding* forwarding) {
     EXPECT_PRED1(is_power_of_2<size_t>, forwarding->_entries.length()) << CAPTURE(forwarding->_entries.length());
+    EXPECT_GT(forwarding->_entries.length(), forwarding->_page->live_objects()) << CAPTURE(forwarding->_entries.length());
   }
 
   static void find_empty(ZForwarding* forwarding) {
@@ -267,6 +268,9 @@ class ZForwardingTest : public Test {
     test(function, 1023);
     test(function, 1024);
     test(function, 1025);
+
+    // Dense page
+    test(function, (uint32_t)(ZPageSizeSmall / 16 / 2) + 1);
   }
 };
 
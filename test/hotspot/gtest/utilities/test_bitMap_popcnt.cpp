@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2020, SAP and/or its affiliates.
  *
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
@@ -145,6 +145,37 @@ TEST_VM(BitMap, popcnt_19)  { test_bitmap_popcnt(17); }
 TEST_VM(BitMap, popcnt_63)  { test_bitmap_popcnt(63); }
 TEST_VM(BitMap, popcnt_300) { test_bitmap_popcnt(300); }
 
+TEST_VM(BitMap, popcnt_random_words) {
+  const BitMap::idx_t words = 1000;
+  CHeapBitMap bm(words * BitsPerWord, mtTest);
+
+  // Expected population count of each word.
+  BitMap::idx_t counts[words];
+  for (BitMap::idx_t i = 0; i < words; i++) {
+    counts[i] = 0;
+    for (BitMap::idx_t bit = i * BitsPerWord; bit < (i + 1) * BitsPerWord; bit++) {
+      if ((os::random() % 3) == 0) {
+        bm.set_bit(bit);
+        counts[i]++;
+      }
+    }
+  }
+
+  // Word aligned ranges with every remainder of words modulo four.
+  for (BitMap::idx_t beg = 0; beg < 4; beg++) {
+    for (BitMap::idx_t end = words - 4; end <= words; end++) {
+      BitMap::idx_t expected = 0;
+      for (BitMap::idx_t i = beg; i < end; i++) {
+        expected += counts[i];
+      }
+      ASSERT_POPCNT_RANGE(bm, beg * BitsPerWord, end * BitsPerWord, expected);
+    }
+  }
+
+  bm.set_range(0, words * BitsPerWord);
+  ASSERT_POPCNT_ALL(bm, words * BitsPerWord);
+}
+
 TEST_VM(BitMap, popcnt_large) {
 
   CHeapBitMap bm(64 * K, mtTest);
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c2.irTests;
+
+import compiler.lib.ir_framework.*;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Random;
+import jdk.test.lib.Asserts;
+import jdk.test.lib.Utils;
+
+/*
+ * @test
+ * @summary Test merging of adjacent byte loads combined with shifts and ors (MergeLoads).
+ * @key randomness
+ * @library /test/lib /
+ * @run driver compiler.c2.irTests.TestMergeLoads
+ */
+public class TestMergeLoads {
+    static final int RANGE = 1000;
+    static final Random RANDOM = Utils.getRandomInstance();
+
+    static final byte[] A = new byte[RANGE];
+    static final ByteBuffer LE = ByteBuffer.wrap(A).order(ByteOrder.LITTLE_ENDIAN);
+    static final ByteBuffer BE = ByteBuffer.wrap(A).order(ByteOrder.BIG_ENDIAN);
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockExperimentalVMOptions", "-XX:+MergeLoads");
+    }
+
+    static {
+        RANDOM.nextBytes(A);
+        // Make sure the sign of the top bytes is exercised both ways.
+        A[3] = (byte)0x80;
+        A[7] = (byte)0x7f;
+    }
+
+    static int randomIndex(int size) {
+        return RANDOM.nextInt(RANGE - size + 1);
+    }
+
+    // ------------------- 4 byte int, little endian -------------------
+
+    @Test
+    @IR(counts = {IRNode.LOAD_I, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB, IRNode.REVERSE_BYTES_I},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int intLE(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 1] & 0xff) <<  8 |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @Run(test = "intLE")
+    static void runIntLE() {
+        int i = randomIndex(4);
+        Asserts.assertEQ(LE.getInt(i), intLE(A, i));
+        Asserts.assertEQ(LE.getInt(0), intLE(A, 0));
+    }
+
+    // ------------------- 4 byte int, big endian -------------------
+
+    @Test
+    @IR(counts = {IRNode.LOAD_I, "1", IRNode.REVERSE_BYTES_I, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int intBE(byte[] a, int i) {
+        return (a[i + 0]       ) << 24 |
+               (a[i + 1] & 0xff) << 16 |
+               (a[i + 2] & 0xff) <<  8 |
+               (a[i + 3] & 0xff);
+    }
+
+    @Run(test = "intBE")
+    static void runIntBE() {
+        int i = randomIndex(4);
+        Asserts.assertEQ(BE.getInt(i), intBE(A, i));
+        Asserts.assertEQ(BE.getInt(0), intBE(A, 0));
+    }
+
+    // ------------------- 2 byte char and short -------------------
+
+    @Test
+    @IR(counts = {IRNode.LOAD_US, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB, IRNode.LOAD_S},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int charLE(byte[] a, int i) {
+        return (a[i + 0] & 0xff) |
+               (a[i + 1] & 0xff) << 8;
+    }
+
+    @Run(test = "charLE")
+    static void runCharLE() {
+        int i = randomIndex(2);
+        Asserts.assertEQ((int)LE.getChar(i), charLE(A, i));
+        Asserts.assertEQ((int)LE.getChar(2), charLE(A, 2));
+    }
+
+    // The sign extended top byte gives a signed short.
+    @Test
+    @IR(counts = {IRNode.LOAD_S, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB, IRNode.LOAD_US},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int shortLE(byte[] a, int i) {
+        return (a[i + 0] & 0xff) |
+               (a[i + 1]       ) << 8;
+    }
+
+    @Run(test = "shortLE")
+    static void runShortLE() {
+        int i = randomIndex(2);
+        Asserts.assertEQ((int)LE.getShort(i), shortLE(A, i));
+        Asserts.assertEQ((int)LE.getShort(2), shortLE(A, 2));
+        Asserts.assertEQ((int)LE.getShort(6), shortLE(A, 6));
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_S, "1", IRNode.REVERSE_BYTES_S, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int shortBE(byte[] a, int i) {
+        return (a[i + 0]       ) << 8 |
+               (a[i + 1] & 0xff);
+    }
+
+    @Run(test = "shortBE")
+    static void runShortBE() {
+        int i = randomIndex(2);
+        Asserts.assertEQ((int)BE.getShort(i), shortBE(A, i));
+        Asserts.assertEQ((int)BE.getShort(3), shortBE(A, 3));
+    }
+
+    // ------------------- 8 byte long -------------------
+
+    @Test
+    @IR(counts = {IRNode.LOAD_L, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB, IRNode.REVERSE_BYTES_L},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static long longLE(byte[] a, int i) {
+        return ((long)(a[i + 0] & 0xff)      ) |
+               ((long)(a[i + 1] & 0xff) <<  8) |
+               ((long)(a[i + 2] & 0xff) << 16) |
+               ((long)(a[i + 3] & 0xff) << 24) |
+               ((long)(a[i + 4] & 0xff) << 32) |
+               ((long)(a[i + 5] & 0xff) << 40) |
+               ((long)(a[i + 6] & 0xff) << 48) |
+               ((long)(a[i + 7]       ) << 56);
+    }
+
+    @Run(test = "longLE")
+    static void runLongLE() {
+        int i = randomIndex(8);
+        Asserts.assertEQ(LE.getLong(i), longLE(A, i));
+        Asserts.assertEQ(LE.getLong(0), longLE(A, 0));
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_L, "1", IRNode.REVERSE_BYTES_L, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static long longBE(byte[] a, int i) {
+        return ((long)(a[i + 0]       ) << 56) |
+               ((long)(a[i + 1] & 0xff) << 48) |
+               ((long)(a[i + 2] & 0xff) << 40) |
+               ((long)(a[i + 3] & 0xff) << 32) |
+               ((long)(a[i + 4] & 0xff) << 24) |
+               ((long)(a[i + 5] & 0xff) << 16) |
+               ((long)(a[i + 6] & 0xff) <<  8) |
+               ((long)(a[i + 7] & 0xff)      );
+    }
+
+    @Run(test = "longBE")
+    static void runLongBE() {
+        int i = randomIndex(8);
+        Asserts.assertEQ(BE.getLong(i), longBE(A, i));
+        Asserts.assertEQ(BE.getLong(0), longBE(A, 0));
+    }
+
+    // ------------------- Must not merge -------------------
+
+    // Only three of the four bytes.
+    @Test
+    @IR(failOn = {IRNode.LOAD_I, IRNode.LOAD_US, IRNode.LOAD_S},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int missingTerm(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 1] & 0xff) <<  8 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @DontCompile
+    static int missingTermReference(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 1] & 0xff) <<  8 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @Run(test = "missingTerm")
+    static void runMissingTerm() {
+        int i = randomIndex(4);
+        Asserts.assertEQ(missingTermReference(A, i), missingTerm(A, i));
+    }
+
+    // The same byte twice, at two different shifts.
+    @Test
+    @IR(failOn = {IRNode.LOAD_I},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int duplicatedTerm(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 0] & 0xff) <<  8 |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @DontCompile
+    static int duplicatedTermReference(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 0] & 0xff) <<  8 |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @Run(test = "duplicatedTerm")
+    static void runDuplicatedTerm() {
+        int i = randomIndex(4);
+        Asserts.assertEQ(duplicatedTermReference(A, i), duplicatedTerm(A, i));
+    }
+
+    // A sign extended byte below the top byte would clobber the bytes above it.
+    @Test
+    @IR(failOn = {IRNode.LOAD_I},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int signedLowByte(byte[] a, int i) {
+        return (a[i + 0]       )       |
+               (a[i + 1] & 0xff) <<  8 |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @DontCompile
+    static int signedLowByteReference(byte[] a, int i) {
+        return (a[i + 0]       )       |
+               (a[i + 1] & 0xff) <<  8 |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @Run(test = "signedLowByte")
+    static void runSignedLowByte() {
+        int i = randomIndex(4);
+        Asserts.assertEQ(signedLowByteReference(A, i), signedLowByte(A, i));
+        Asserts.assertEQ(signedLowByteReference(A, 3), signedLowByte(A, 3));
+    }
+
+    // ------------------- RangeChecks -------------------
+
+    // Each byte load has its own RangeCheck. After RangeCheck smearing the
+    // loads are merged, and an index close to the end of the array must
+    // still throw before anything is read out of bounds.
+    @Test
+    @IR(counts = {IRNode.LOAD_I, "1"},
+        failOn = {IRNode.LOAD_B, IRNode.LOAD_UB},
+        applyIfPlatformOr = {"x64", "true", "aarch64", "true"})
+    static int rangeCheck(byte[] a, int i) {
+        return (a[i + 0] & 0xff)       |
+               (a[i + 1] & 0xff) <<  8 |
+               (a[i + 2] & 0xff) << 16 |
+               (a[i + 3] & 0xff) << 24;
+    }
+
+    @Run(test = "rangeCheck")
+    static void runRangeCheck(RunInfo info) {
+        int i = randomIndex(4);
+        Asserts.assertEQ(LE.getInt(i), rangeCheck(A, i));
+        if (!info.isWarmUp()) {
+            for (int j = RANGE - 3; j < RANGE + 1; j++) {
+                try {
+                    rangeCheck(A, j);
+                    throw new RuntimeException("Expected ArrayIndexOutOfBoundsException for index " + j);
+                } catch (ArrayIndexOutOfBoundsException e) {
+                    // expected
+                }
+            }
+            try {
+                rangeCheck(A, -1);
+                throw new RuntimeException("Expected ArrayIndexOutOfBoundsException for index -1");
+            } catch (ArrayIndexOutOfBoundsException e) {
+                // expected
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c2.irTests;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary Test that allocation merges of loop-carried accumulator objects are
+ *          reduced at loop heads, and that the objects are rematerialized with
+ *          the right field values when deoptimizing inside the loop.
+ * @library /test/lib /
+ * @run driver compiler.c2.irTests.TestReduceAllocationMergesInLoops
+ */
+public class TestReduceAllocationMergesInLoops {
+    static final int RANGE = 1000;
+    static final int TRAP_INDEX = RANGE / 2;
+
+    static final int[] A = new int[RANGE];
+    static final int[] TRAP = new int[RANGE];
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockExperimentalVMOptions", "-XX:+ReduceAllocationMergesInLoops");
+    }
+
+    static {
+        for (int i = 0; i < RANGE; i++) {
+            A[i] = i;
+            TRAP[i] = i;
+        }
+        TRAP[TRAP_INDEX] = -1;
+    }
+
+    static class Acc {
+        int sum;
+        int count;
+
+        Acc(int sum, int count) {
+            this.sum = sum;
+            this.count = count;
+        }
+    }
+
+    // The accumulator of the previous iteration is replaced by a new one on
+    // every iteration, so both allocations are scalar replaced. A negative
+    // element is never seen during warmup, so that branch becomes an
+    // uncommon trap inside the loop that has to rematerialize 'acc'.
+    @Test
+    @IR(failOn = IRNode.ALLOC)
+    static int accumulate(int[] a) {
+        Acc acc = new Acc(0, 0);
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] < 0) {
+                return acc.sum * 1000 + acc.count;
+            }
+            acc = new Acc(acc.sum + a[i], acc.count + 1);
+        }
+        return acc.sum + acc.count;
+    }
+
+    static int expected(int[] a) {
+        int sum = 0;
+        int count = 0;
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] < 0) {
+                return sum * 1000 + count;
+            }
+            sum += a[i];
+            count++;
+        }
+        return sum + count;
+    }
+
+    @Run(test = "accumulate")
+    static void runAccumulate(RunInfo info) {
+        Asserts.assertEQ(expected(A), accumulate(A));
+        if (!info.isWarmUp()) {
+            // Deoptimizes at TRAP_INDEX with the fields of the accumulator
+            // built by the previous iterations.
+            Asserts.assertEQ(expected(TRAP), accumulate(TRAP));
+        }
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary Test auto vectorization of array accesses whose invariant offsets
+ *          differ, guarded by a speculative runtime check that they do not
+ *          overlap, and the fallback when they do.
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestSpeculativeAliasingInvariants
+ */
+public class TestSpeculativeAliasingInvariants {
+    static final int SIZE = 10_000;
+    static final int SLACK = 16;
+
+    static final int[] A = new int[SIZE + 2 * SLACK];
+    static final int[] B = new int[SIZE + 2 * SLACK];
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockExperimentalVMOptions",
+                                   "-XX:+UseAutoVectorizationSpeculativeAliasingChecks");
+    }
+
+    // Same array, the invariants x and y are only known at runtime.
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.ADD_VI,        IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.STORE_VECTOR, "> 0"},
+        applyIfPlatform = {"64-bit", "true"},
+        applyIf = {"AlignVector", "false"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"})
+    static void shift(int[] a, int x, int y, int n) {
+        for (int i = 0; i < n; i++) {
+            a[i + x] = a[i + y] + 1;
+        }
+    }
+
+    // Arrays that may or may not be the same, with different positions.
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.ADD_VI,        IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.STORE_VECTOR, "> 0"},
+        applyIfPlatform = {"64-bit", "true"},
+        applyIf = {"AlignVector", "false"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"})
+    static void copy(int[] dst, int dstPos, int[] src, int srcPos, int n) {
+        for (int i = 0; i < n; i++) {
+            dst[dstPos + i] = src[srcPos + i] + 1;
+        }
+    }
+
+    @DontCompile
+    static void copyReference(int[] dst, int dstPos, int[] src, int srcPos, int n) {
+        for (int i = 0; i < n; i++) {
+            dst[dstPos + i] = src[srcPos + i] + 1;
+        }
+    }
+
+    @Run(test = "shift")
+    static void runShift(RunInfo info) {
+        // Far apart, the speculative check passes.
+        runAndVerifyShift(0, SIZE / 2 + SLACK, SIZE / 2);
+        if (!info.isWarmUp()) {
+            // Overlapping ranges, the speculative check fails and the fallback
+            // path must give the same results as scalar code.
+            for (int offset = -SLACK; offset <= SLACK; offset++) {
+                runAndVerifyShift(SLACK + offset, SLACK, SIZE);
+            }
+        }
+    }
+
+    @Run(test = "copy")
+    static void runCopy(RunInfo info) {
+        // Different arrays, the speculative check passes whatever the positions.
+        runAndVerifyCopy(B, SLACK, A, 0);
+        runAndVerifyCopy(B, 0, A, SLACK);
+        if (!info.isWarmUp()) {
+            // The same array with overlapping ranges.
+            for (int offset = -SLACK; offset <= SLACK; offset++) {
+                runAndVerifyCopy(A, SLACK + offset, A, SLACK);
+            }
+        }
+    }
+
+    static void init() {
+        for (int i = 0; i < A.length; i++) {
+            A[i] = i;
+            B[i] = -i;
+        }
+    }
+
+    static void runAndVerifyShift(int x, int y, int n) {
+        init();
+        int[] expected = A.clone();
+        copyReference(expected, x, expected, y, n);
+
+        shift(A, x, y, n);
+
+        verify(expected, A, "x " + x + ", y " + y);
+    }
+
+    static void runAndVerifyCopy(int[] dst, int dstPos, int[] src, int srcPos) {
+        init();
+        int[] expectedA = A.clone();
+        int[] expectedB = B.clone();
+        copyReference(dst == A ? expectedA : expectedB, dstPos,
+                      src == A ? expectedA : expectedB, srcPos, SIZE);
+
+        copy(dst, dstPos, src, srcPos, SIZE);
+
+        String context = "dstPos " + dstPos + ", srcPos " + srcPos + ", same array " + (dst == src);
+        verify(expectedA, A, context);
+        verify(expectedB, B, context);
+    }
+
+    static void verify(int[] expected, int[] actual, String context) {
+        for (int i = 0; i < expected.length; i++) {
+            Asserts.assertEQ(expected[i], actual[i], "wrong value at " + i + ", " + context);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import java.lang.foreign.Arena;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.ValueLayout;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary Test auto vectorization of native memory accesses with different bases,
+ *          guarded by a speculative runtime check that they do not overlap.
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestSpeculativeAliasingNative
+ */
+public class TestSpeculativeAliasingNative {
+    static final int SIZE = 10_000;
+    static final int SLACK = 16;
+
+    // One native segment, so that slices of it can overlap.
+    static final MemorySegment SEGMENT = Arena.ofAuto().allocate(2L * 4 * (SIZE + SLACK), 64);
+    static final MemorySegment FIRST = SEGMENT.asSlice(0, 4L * (SIZE + SLACK));
+    static final MemorySegment SECOND = SEGMENT.asSlice(4L * (SIZE + SLACK), 4L * (SIZE + SLACK));
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockExperimentalVMOptions",
+                                   "-XX:+UseAutoVectorizationSpeculativeAliasingChecks");
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.ADD_VI,        IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.STORE_VECTOR, "> 0"},
+        applyIfPlatform = {"64-bit", "true"},
+        applyIf = {"AlignVector", "false"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"})
+    static void copy(MemorySegment dst, MemorySegment src, int n) {
+        for (int i = 0; i < n; i++) {
+            dst.setAtIndex(ValueLayout.JAVA_INT, i, src.getAtIndex(ValueLayout.JAVA_INT, i) + 1);
+        }
+    }
+
+    @DontCompile
+    static void copyReference(int[] a, int dstPos, int srcPos, int n) {
+        for (int i = 0; i < n; i++) {
+            a[dstPos + i] = a[srcPos + i] + 1;
+        }
+    }
+
+    @Run(test = "copy")
+    static void runCopy(RunInfo info) {
+        // Different segments, the speculative check passes.
+        runAndVerify(SECOND, 0, FIRST, 0);
+        if (!info.isWarmUp()) {
+            // Overlapping slices of the same memory, the speculative check fails
+            // and the fallback path must give the same results as scalar code.
+            for (int offset = -SLACK; offset <= SLACK; offset++) {
+                runAndVerify(FIRST, Math.max(offset, 0), FIRST, Math.max(-offset, 0));
+            }
+        }
+    }
+
+    // Run copy from srcSeg at srcPos to dstSeg at dstPos, and compare all of SEGMENT
+    // with the reference run on the same initial values.
+    static void runAndVerify(MemorySegment dstSeg, int dstPos, MemorySegment srcSeg, int srcPos) {
+        for (int i = 0; i < SIZE + SLACK; i++) {
+            FIRST.setAtIndex(ValueLayout.JAVA_INT, i, i);
+            SECOND.setAtIndex(ValueLayout.JAVA_INT, i, -i);
+        }
+        int[] expected = SEGMENT.toArray(ValueLayout.JAVA_INT);
+        int dstBase = dstSeg == FIRST ? 0 : SIZE + SLACK;
+        int srcBase = srcSeg == FIRST ? 0 : SIZE + SLACK;
+        copyReference(expected, dstBase + dstPos, srcBase + srcPos, SIZE);
+
+        copy(dstSeg.asSlice(4L * dstPos), srcSeg.asSlice(4L * srcPos), SIZE);
+
+        int[] actual = SEGMENT.toArray(ValueLayout.JAVA_INT);
+        for (int i = 0; i < expected.length; i++) {
+            Asserts.assertEQ(expected[i], actual[i],
+                             "wrong value at " + i + ", dstPos " + dstPos + ", srcPos " + srcPos);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test id=vectorized
+ * @summary Test that a predictable int or long diamond is if-converted and
+ *          vectorized as a blend with UseVectorCmov.
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestVectorCMoveSupport
+ */
+
+/*
+ * @test id=rejected
+ * @summary Test that a predictable long diamond is kept as a branch with
+ *          UseVectorCmov when long vectors are not supported.
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestVectorCMoveSupport -XX:MaxVectorSize=8
+ */
+public class TestVectorCMoveSupport {
+    static final int RANGE = 1024;
+
+    static final int[] AI = new int[RANGE];
+    static final int[] BI = new int[RANGE];
+    static final int[] RI = new int[RANGE];
+    static final long[] AL = new long[RANGE];
+    static final long[] BL = new long[RANGE];
+    static final long[] RL = new long[RANGE];
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        framework.addFlags("-XX:+UseVectorCmov");
+        framework.addFlags(args);
+        framework.start();
+    }
+
+    static {
+        // The branch goes the other way for 1 in 16 elements, which is
+        // predictable enough for conditional_move() to keep a plain branch
+        // unless the CMove can be vectorized.
+        for (int i = 0; i < RANGE; i++) {
+            AI[i] = i;
+            BI[i] = (i % 16 == 0) ? -i : RANGE + i;
+            AL[i] = i;
+            BL[i] = (i % 16 == 0) ? -i : RANGE + i;
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.VECTOR_MASK_CMP_I, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.VECTOR_BLEND_I,    IRNode.VECTOR_SIZE_ANY, "> 0"},
+        applyIf = {"MaxVectorSize", ">= 16"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"})
+    static void selectInt(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = a[i] < b[i] ? a[i] + 1 : b[i] - 1;
+        }
+    }
+
+    @Run(test = "selectInt")
+    static void runSelectInt() {
+        selectInt(AI, BI, RI);
+        for (int i = 0; i < RANGE; i++) {
+            Asserts.assertEQ(AI[i] < BI[i] ? AI[i] + 1 : BI[i] - 1, RI[i]);
+        }
+    }
+
+    @Test
+    @IR(counts = {IRNode.VECTOR_MASK_CMP_L, IRNode.VECTOR_SIZE_ANY, "> 0",
+                  IRNode.VECTOR_BLEND_L,    IRNode.VECTOR_SIZE_ANY, "> 0"},
+        applyIf = {"MaxVectorSize", ">= 32"},
+        applyIfCPUFeatureOr = {"avx2", "true", "asimd", "true"})
+    // With 8 byte vectors there are no long vectors, so VectorBlend is not
+    // supported for longs and the diamond must not become a CMove.
+    @IR(failOn = {IRNode.CMOVE_L, IRNode.VECTOR_BLEND_L, IRNode.VECTOR_SIZE_ANY},
+        applyIf = {"MaxVectorSize", "<= 8"})
+    static void selectLong(long[] a, long[] b, long[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = a[i] < b[i] ? a[i] + 1 : b[i] - 1;
+        }
+    }
+
+    @Run(test = "selectLong")
+    static void runSelectLong() {
+        selectLong(AL, BL, RL);
+        for (int i = 0; i < RANGE; i++) {
+            Asserts.assertEQ(AL[i] < BL[i] ? AL[i] + 1 : BL[i] - 1, RL[i]);
+        }
+    }
+}
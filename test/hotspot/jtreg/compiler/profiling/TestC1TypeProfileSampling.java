@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that every profiling point in tier 3 code still records
+ *          argument types when C1TypeProfileSampleFreqLog samples the type
+ *          profile updates, also for call sites that alternate.
+ * @library /test/lib
+ * @requires vm.flagless
+ * @requires vm.compiler1.enabled
+ * @run driver compiler.profiling.TestC1TypeProfileSampling
+ */
+
+package compiler.profiling;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestC1TypeProfileSampling {
+
+    private static final String SEPARATOR = "------------------------------------------------------------------------";
+
+    public static void main(String[] args) throws Exception {
+        // Launcher.run has two call sites that alternate. With a sampling
+        // period of two, sampling by a plain counter would never update the
+        // profile of one of them.
+        for (int freqLog : new int[] { 1, 2 }) {
+            String data = methodData(freqLog);
+            Asserts.assertTrue(data.contains("argument types"),
+                               "Expected argument type profiles:\n" + data);
+            Asserts.assertFalse(data.contains("stack(0) none"),
+                                "Expected every call site to record an argument type:\n" + data);
+            Asserts.assertTrue(data.contains("java/lang/String"),
+                               "Expected the argument type of the first call site:\n" + data);
+            Asserts.assertTrue(data.contains("java/lang/Integer"),
+                               "Expected the argument type of the second call site:\n" + data);
+        }
+    }
+
+    // Returns the printed method data of Launcher.run.
+    private static String methodData(int freqLog) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+UnlockExperimentalVMOptions",
+                // Only tier 3 code updates the profiles.
+                "-XX:TieredStopAtLevel=3",
+                "-XX:-ProfileInterpreter",
+                // Only profile argument types at call sites.
+                "-XX:TypeProfileLevel=002",
+                "-XX:C1TypeProfileSampleFreqLog=" + freqLog,
+                "-XX:CompileCommand=quiet",
+                "-XX:CompileCommand=dontinline," + Launcher.class.getName() + "::sink",
+                "-XX:+PrintMethodData",
+                Launcher.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        String out = output.getStdout();
+        String header = Launcher.class.getName() + "::run";
+        int start = out.indexOf(header);
+        Asserts.assertGreaterThanOrEqual(start, 0, "No method data printed for " + header);
+        int end = out.indexOf(SEPARATOR, start);
+        return end < 0 ? out.substring(start) : out.substring(start, end);
+    }
+
+    public static class Launcher {
+
+        static int sink(Object o) {
+            return o.hashCode();
+        }
+
+        static int run(Object a, Object b) {
+            return sink(a) + sink(b);
+        }
+
+        public static void main(String[] args) {
+            Object a = "a";
+            Object b = Integer.valueOf(1);
+            int sum = 0;
+            for (int i = 0; i < 50_000; i++) {
+                sum += run(a, b);
+            }
+            System.out.println("sum: " + sum);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that ProfileStreamArguments adds argument type profiles at
+ *          call sites of Stream operations.
+ * @library /test/lib
+ * @requires vm.flagless
+ * @requires vm.compiler2.enabled
+ * @run driver compiler.profiling.TestStreamArgumentProfiling
+ */
+
+package compiler.profiling;
+
+import java.util.List;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestStreamArgumentProfiling {
+
+    private static final String SEPARATOR = "------------------------------------------------------------------------";
+
+    public static void main(String[] args) throws Exception {
+        String profiled = methodData(true);
+        Asserts.assertTrue(profiled.contains("argument types"),
+                           "Expected argument type profiles at Stream call sites:\n" + profiled);
+        Asserts.assertTrue(profiled.contains("$$Lambda"),
+                           "Expected a lambda type in the argument profiles:\n" + profiled);
+
+        String unprofiled = methodData(false);
+        Asserts.assertFalse(unprofiled.contains("argument types"),
+                            "Expected no argument type profiles without ProfileStreamArguments:\n" + unprofiled);
+    }
+
+    // Returns the printed method data of Launcher.run.
+    private static String methodData(boolean profileStreamArguments) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:-TieredCompilation",
+                "-XX:TypeProfileLevel=111",
+                "-XX:" + (profileStreamArguments ? "+" : "-") + "ProfileStreamArguments",
+                "-XX:+PrintMethodData",
+                Launcher.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        String out = output.getStdout();
+        String header = Launcher.class.getName() + "::run";
+        int start = out.indexOf(header);
+        Asserts.assertGreaterThanOrEqual(start, 0, "No method data printed for " + header);
+        int end = out.indexOf(SEPARATOR, start);
+        return end < 0 ? out.substring(start) : out.substring(start, end);
+    }
+
+    public static class Launcher {
+
+        static int run(List<Integer> list) {
+            return list.stream()
+                       .map(i -> i + 1)
+                       .filter(i -> i > 0)
+                       .mapToInt(Integer::intValue)
+                       .sum();
+        }
+
+        public static void main(String[] args) {
+            List<Integer> list = List.of(1, 2, 3, 4);
+            int sum = 0;
+            for (int i = 0; i < 20_000; i++) {
+                sum += run(list);
+            }
+            System.out.println("sum: " + sum);
+        }
+    }
+}
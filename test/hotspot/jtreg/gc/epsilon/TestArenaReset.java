@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.epsilon;
+
+/**
+ * @test id=enabled
+ * @requires vm.gc.Epsilon
+ * @summary Epsilon discards the objects allocated after an arena checkpoint
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonArenaReset
+ *                   -Xmx256m -Xlog:gc
+ *                   gc.epsilon.TestArenaReset enabled
+ */
+
+/**
+ * @test id=disabled
+ * @requires vm.gc.Epsilon
+ * @summary Epsilon refuses arena checkpoints without EpsilonArenaReset
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC
+ *                   -Xmx256m
+ *                   gc.epsilon.TestArenaReset disabled
+ */
+
+import jdk.test.lib.Asserts;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestArenaReset {
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    static final int ALLOC_SIZE = 64 * 1024 * 1024;
+    static final int CHUNK_SIZE = 64 * 1024;
+
+    static volatile Object sink;
+
+    static long used() {
+        Runtime rt = Runtime.getRuntime();
+        return rt.totalMemory() - rt.freeMemory();
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args[0].equals("disabled")) {
+            Asserts.assertFalse(WB.epsilonCheckpointArena(), "Checkpoint should be refused");
+            Asserts.assertFalse(WB.epsilonResetArenaToCheckpoint(), "Reset should be refused");
+            return;
+        }
+
+        // Nothing to reset to before the first checkpoint
+        Asserts.assertFalse(WB.epsilonResetArenaToCheckpoint(), "Reset without checkpoint should be refused");
+
+        Asserts.assertTrue(WB.epsilonCheckpointArena(), "Checkpoint should succeed");
+        long usedAtCheckpoint = used();
+
+        // No reference to these arrays survives the loop
+        for (int i = 0; i < ALLOC_SIZE / CHUNK_SIZE; i++) {
+            sink = new byte[CHUNK_SIZE];
+        }
+        sink = null;
+        long usedAfterAlloc = used();
+        Asserts.assertGTE(usedAfterAlloc - usedAtCheckpoint, (long)ALLOC_SIZE,
+                          "Allocations should be accounted as used");
+
+        Asserts.assertTrue(WB.epsilonResetArenaToCheckpoint(), "Reset should succeed");
+        long usedAfterReset = used();
+        System.out.println("Used at checkpoint: " + usedAtCheckpoint +
+                           ", after allocation: " + usedAfterAlloc +
+                           ", after reset: " + usedAfterReset);
+
+        // The thread may have taken a new TLAB above the checkpoint, but the
+        // bulk of the allocation must be gone.
+        Asserts.assertLT(usedAfterReset, usedAfterAlloc - ALLOC_SIZE / 2,
+                         "Reset should discard the allocations after the checkpoint");
+
+        // The heap keeps working after the reset
+        for (int i = 0; i < ALLOC_SIZE / CHUNK_SIZE; i++) {
+            sink = new byte[CHUNK_SIZE];
+        }
+        sink = null;
+    }
+}
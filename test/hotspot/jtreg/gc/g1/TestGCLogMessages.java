@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -170,6 +170,7 @@ public boolean isAvailable() {
 
         // Post Evacuate Cleanup 1
         new LogMessageWithLevel("Post Evacuate Cleanup 1:", Level.DEBUG),
+        new LogMessageWithLevel("Worker Utilization:", Level.DEBUG),
         new LogMessageWithLevel("Merge Per-Thread State \\(ms\\):", Level.DEBUG),
         new LogMessageWithLevel("LAB Waste:", Level.DEBUG),
         new LogMessageWithLevel("LAB Undo Waste:", Level.DEBUG),
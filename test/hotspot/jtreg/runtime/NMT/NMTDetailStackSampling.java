@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that NMTDetailStackSampleInterval only samples malloc call
+ *          stacks and that virtual memory regions keep their call stacks.
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver NMTDetailStackSampling
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class NMTDetailStackSampling {
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:NativeMemoryTracking=detail",
+                "-XX:NMTDetailStackSampleInterval=4",
+                "-XX:+PrintNMTStatistics",
+                "-Xmx64m",
+                "-version");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        output.shouldContain("Malloc call stacks sampled for one in 4 allocations");
+        // Mallocs that were not sampled are accounted to the empty stack.
+        output.shouldContain("[no call stack]");
+        // Virtual memory is not sampled, so the heap reservation still
+        // reports where it came from.
+        output.shouldMatch("\\] reserved( and committed)? \\d+KB for Java Heap from");
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Attach native threads with small stacks, some of them not created
+ *          by pthread, and check that their stack guard zones work and are
+ *          removed on detach.
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @run main/othervm/native TestAttachSmallStack
+ */
+
+import jdk.test.lib.Asserts;
+
+public class TestAttachSmallStack {
+
+    static final int THREADS = 10;
+
+    /**
+     * Run THREADS native threads one after the other. Each attaches, calls
+     * overflow() and detaches. Returns the smallest recursion depth reached,
+     * or -1 on failure.
+     */
+    static native int runAttachedThreads(int threads, boolean ownStack);
+
+    static {
+        System.loadLibrary("attachSmallStack");
+    }
+
+    static int depth;
+
+    static void recurse() {
+        depth++;
+        recurse();
+    }
+
+    // Called from the attached native threads.
+    static int overflow() {
+        depth = 0;
+        try {
+            recurse();
+        } catch (StackOverflowError e) {
+            // Expected
+        }
+        return depth;
+    }
+
+    public static void main(String[] args) throws Throwable {
+        // Small stacks allocated by pthread_create()
+        int depth = runAttachedThreads(THREADS, false);
+        Asserts.assertGT(depth, 0, "StackOverflowError not thrown on pthread stack");
+        // A small mmap()ed stack handed to pthread, reused by every thread
+        depth = runAttachedThreads(THREADS, true);
+        Asserts.assertGT(depth, 0, "StackOverflowError not thrown on own stack");
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "jni.h"
+
+#define STACK_SIZE (256 * 1024)
+
+static JavaVM* jvm;
+static jclass test_class;
+static jmethodID overflow_method;
+static int min_depth;
+
+static void* thread_start(void* unused) {
+  JNIEnv *env;
+  jint depth;
+  int res;
+
+  res = (*jvm)->AttachCurrentThread(jvm, (void **)&env, NULL);
+  if (res != JNI_OK) {
+    fprintf(stderr, "Test ERROR. Can't attach current thread: %d\n", res);
+    exit(1);
+  }
+
+  depth = (*env)->CallStaticIntMethod(env, test_class, overflow_method);
+  if ((*env)->ExceptionOccurred(env) != NULL) {
+    (*env)->ExceptionDescribe(env);
+    exit(1);
+  }
+  printf("Attached thread reached depth %d\n", depth);
+  if (min_depth < 0 || depth < min_depth) {
+    min_depth = depth;
+  }
+
+  res = (*jvm)->DetachCurrentThread(jvm);
+  if (res != JNI_OK) {
+    fprintf(stderr, "Test ERROR. Can't detach current thread: %d\n", res);
+    exit(1);
+  }
+  return NULL;
+}
+
+JNIEXPORT jint JNICALL
+Java_TestAttachSmallStack_runAttachedThreads
+(JNIEnv *env, jclass cls, jint threads, jboolean own_stack) {
+  void* stack = NULL;
+  int res;
+  int i;
+
+  res = (*env)->GetJavaVM(env, &jvm);
+  if (res != JNI_OK) {
+    fprintf(stderr, "Test ERROR. Can't extract JavaVM: %d\n", res);
+    exit(1);
+  }
+  test_class = (*env)->NewGlobalRef(env, cls);
+  overflow_method = (*env)->GetStaticMethodID(env, cls, "overflow", "()I");
+  if (overflow_method == NULL) {
+    fprintf(stderr, "Test ERROR. Can't find method overflow\n");
+    exit(1);
+  }
+
+  if (own_stack) {
+    stack = mmap(NULL, STACK_SIZE, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if (stack == MAP_FAILED) {
+      perror("mmap");
+      exit(1);
+    }
+  }
+
+  min_depth = -1;
+  for (i = 0; i < threads; i++) {
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if (own_stack) {
+      pthread_attr_setstack(&attr, stack, STACK_SIZE);
+    } else {
+      pthread_attr_setstacksize(&attr, STACK_SIZE);
+    }
+
+    if ((res = pthread_create(&thread, &attr, thread_start, NULL)) != 0) {
+      fprintf(stderr, "TEST ERROR: pthread_create failed: %s (%d)\n", strerror(res), res);
+      exit(1);
+    }
+    pthread_attr_destroy(&attr);
+
+    if ((res = pthread_join(thread, NULL)) != 0) {
+      fprintf(stderr, "TEST ERROR: pthread_join failed: %s (%d)\n", strerror(res), res);
+      exit(1);
+    }
+  }
+
+  if (own_stack) {
+    munmap(stack, STACK_SIZE);
+  }
+  (*env)->DeleteGlobalRef(env, test_class);
+  return min_depth;
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Function;
+import java.util.function.Supplier;
+import java.util.stream.Collectors;
+import java.util.stream.IntStream;
+
+/**
+ * Measures the wall clock time of launching a JVM that runs a small
+ * startup-heavy workload (reflective wiring, lambdas and streams), with
+ * the default CDS archive, without CDS, and with an AOT cache created by a
+ * training run of the same workload.
+ *
+ * For a breakdown of a single configuration, run the workload directly with
+ * {@code -Xlog:startuptime} or inspect the sun.cls and sun.ci PerfData
+ * counters with {@code jcmd <pid> PerfCounter.print}.
+ */
+@BenchmarkMode(Mode.SingleShotTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 3)
+@Measurement(iterations = 10)
+@Fork(value = 1)
+@State(Scope.Benchmark)
+public class StartupAOTCache {
+
+    public enum Config {
+        NO_CDS,
+        DEFAULT_CDS,
+        AOT_CACHE
+    }
+
+    @Param
+    public Config config;
+
+    private Path tempDir;
+    private List<String> command;
+
+    @Setup(Level.Trial)
+    public void setup() throws Exception {
+        tempDir = Files.createTempDirectory("startup-aot");
+        String java = Path.of(System.getProperty("java.home"), "bin", "java").toString();
+        String classpath = System.getProperty("java.class.path");
+        List<String> options = new ArrayList<>();
+        switch (config) {
+            case NO_CDS -> options.add("-Xshare:off");
+            case DEFAULT_CDS -> options.add("-Xshare:auto");
+            case AOT_CACHE -> {
+                String cache = tempDir.resolve("workload.aot").toString();
+                // Training run, which also assembles the cache on exit.
+                run(command(java, classpath, List.of("-XX:AOTCacheOutput=" + cache)));
+                options.add("-XX:AOTCache=" + cache);
+            }
+        }
+        command = command(java, classpath, options);
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() throws IOException {
+        try (var paths = Files.walk(tempDir)) {
+            paths.sorted(Comparator.reverseOrder()).map(Path::toFile).forEach(File::delete);
+        }
+    }
+
+    private static List<String> command(String java, String classpath, List<String> options) {
+        List<String> cmd = new ArrayList<>();
+        cmd.add(java);
+        cmd.addAll(options);
+        cmd.add("-cp");
+        cmd.add(classpath);
+        cmd.add(Workload.class.getName());
+        return cmd;
+    }
+
+    private static void run(List<String> cmd) throws IOException, InterruptedException {
+        Process p = new ProcessBuilder(cmd).redirectErrorStream(true)
+                                           .redirectOutput(ProcessBuilder.Redirect.DISCARD)
+                                           .start();
+        int exit = p.waitFor();
+        if (exit != 0) {
+            throw new IllegalStateException("Workload failed with exit code " + exit + ": " + cmd);
+        }
+    }
+
+    @Benchmark
+    public void launch() throws Exception {
+        run(command);
+    }
+
+    /**
+     * The launched workload: wires a few components by reflection, like a
+     * dependency injection container would, and exercises lambdas and streams.
+     */
+    public static class Workload {
+
+        public interface Component {
+            String name();
+        }
+
+        public static class Repository implements Component {
+            public String name() { return "repository"; }
+        }
+
+        public static class Service implements Component {
+            final Repository repository;
+            public Service(Repository repository) { this.repository = repository; }
+            public String name() { return "service(" + repository.name() + ")"; }
+        }
+
+        public static class Controller implements Component {
+            final Service service;
+            public Controller(Service service) { this.service = service; }
+            public String name() { return "controller(" + service.name() + ")"; }
+        }
+
+        static Object create(Class<?> type, Map<Class<?>, Object> instances) throws Exception {
+            Object instance = instances.get(type);
+            if (instance == null) {
+                var constructor = type.getConstructors()[0];
+                Object[] args = new Object[constructor.getParameterCount()];
+                for (int i = 0; i < args.length; i++) {
+                    args[i] = create(constructor.getParameterTypes()[i], instances);
+                }
+                instance = constructor.newInstance(args);
+                instances.put(type, instance);
+            }
+            return instance;
+        }
+
+        public static void main(String[] args) throws Exception {
+            Controller controller = (Controller) create(Controller.class, new HashMap<>());
+
+            List<Supplier<String>> suppliers = List.of(controller::name, () -> "a", () -> "b");
+            List<Function<Integer, String>> functions = List.of(i -> "x" + i, String::valueOf, Integer::toHexString);
+            String result = IntStream.range(0, 1000)
+                                     .boxed()
+                                     .map(i -> functions.get(i % functions.size()).apply(i))
+                                     .filter(s -> !s.isEmpty())
+                                     .collect(Collectors.joining(","));
+            System.out.println(suppliers.get(0).get() + " " + result.length());
+        }
+    }
+}
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.AuxCounters;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+/**
+ * Measures C2 compile time for a corpus of methods that are known to stress
+ * individual compiler phases: a large switch (parsing, IGVN), a deep call
+ * chain (inlining) and vectorizable loops (loop opts, SuperWord, register
+ * allocation). Each benchmark invocation launches a JVM that compiles only
+ * the selected corpus method with C2, before it is executed.
+ *
+ * The compile cost is the {@code compileMs} secondary result: the total
+ * compilation time the child JVM reports with {@code -XX:+CITime}. The primary
+ * score is the wall time of the whole child JVM, including startup and the
+ * execution of the corpus, and only bounds the compile cost from above.
+ *
+ * Per-phase compile times and generated code sizes for a single method are
+ * printed by running the corpus directly, for example:
+ * <pre>
+ * java -XX:-TieredCompilation -Xbatch -XX:+CITime
+ *      -XX:CompileCommand=compileonly,*C2CompileCorpus$Corpus::loops
+ *      -XX:CompileCommand=MemStat,*C2CompileCorpus$Corpus::loops,print
+ *      -XX:CompileCommand=PrintCompilation,*C2CompileCorpus$Corpus::loops
+ *      -cp benchmarks.jar org.openjdk.bench.vm.compiler.C2CompileCorpus$Corpus loops
+ * </pre>
+ */
+@BenchmarkMode(Mode.SingleShotTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 2)
+@Measurement(iterations = 10)
+@Fork(value = 1)
+@State(Scope.Benchmark)
+public class C2CompileCorpus {
+
+    private static final Pattern TOTAL_COMPILATION_TIME =
+        Pattern.compile("Total compilation time\\s*:\\s*([0-9.]+) s");
+
+    @Param({"hugeSwitch", "deepInlining", "loops"})
+    public String method;
+
+    private List<String> command;
+
+    @State(Scope.Thread)
+    @AuxCounters(AuxCounters.Type.EVENTS)
+    public static class CompileTime {
+        // Compilation time reported by the child JVM with -XX:+CITime.
+        public double compileMs;
+
+        @Setup(Level.Iteration)
+        public void reset() {
+            compileMs = 0;
+        }
+    }
+
+    @Setup(Level.Trial)
+    public void setup() {
+        String java = Path.of(System.getProperty("java.home"), "bin", "java").toString();
+        String pattern = "*" + Corpus.class.getSimpleName() + "::" + method;
+        command = List.of(java,
+                          "-XX:-TieredCompilation",
+                          "-Xbatch",
+                          "-XX:+CITime",
+                          "-XX:CompileCommand=quiet",
+                          "-XX:CompileCommand=compileonly," + pattern,
+                          "-cp", System.getProperty("java.class.path"),
+                          Corpus.class.getName(), method);
+    }
+
+    @Benchmark
+    public void compile(CompileTime compileTime) throws IOException, InterruptedException {
+        Process p = new ProcessBuilder(command).redirectErrorStream(true).start();
+        String output = new String(p.getInputStream().readAllBytes());
+        int exit = p.waitFor();
+        if (exit != 0) {
+            throw new IllegalStateException("Corpus run failed with exit code " + exit + ": " + command);
+        }
+        Matcher m = TOTAL_COMPILATION_TIME.matcher(output);
+        if (!m.find()) {
+            throw new IllegalStateException("No CITime output from corpus run: " + command);
+        }
+        compileTime.compileMs += Double.parseDouble(m.group(1)) * 1000;
+    }
+
+    public static class Corpus {
+
+        // Enough invocations to reach the C2 compile threshold with -Xbatch.
+        private static final int INVOCATIONS = 20_000;
+
+        static int hugeSwitch(int x) {
+            return switch (x & 63) {
+                case 0 -> x * 1 ^ 0;
+                case 1 -> x * 3 ^ 7;
+                case 2 -> x * 5 ^ 14;
+                case 3 -> x * 7 ^ 21;
+                case 4 -> x * 9 ^ 28;
+                case 5 -> x * 11 ^ 35;
+                case 6 -> x * 13 ^ 42;
+                case 7 -> x * 15 ^ 49;
+                case 8 -> x * 17 ^ 56;
+                case 9 -> x * 19 ^ 63;
+                case 10 -> x * 21 ^ 70;
+                case 11 -> x * 23 ^ 77;
+                case 12 -> x * 25 ^ 84;
+                case 13 -> x * 27 ^ 91;
+                case 14 -> x * 29 ^ 98;
+                case 15 -> x * 31 ^ 105;
+                case 16 -> x * 33 ^ 112;
+                case 17 -> x * 35 ^ 119;
+                case 18 -> x * 37 ^ 126;
+                case 19 -> x * 39 ^ 133;
+                case 20 -> x * 41 ^ 140;
+                case 21 -> x * 43 ^ 147;
+                case 22 -> x * 45 ^ 154;
+                case 23 -> x * 47 ^ 161;
+                case 24 -> x * 49 ^ 168;
+                case 25 -> x * 51 ^ 175;
+                case 26 -> x * 53 ^ 182;
+                case 27 -> x * 55 ^ 189;
+                case 28 -> x * 57 ^ 196;
+                case 29 -> x * 59 ^ 203;
+                case 30 -> x * 61 ^ 210;
+                case 31 -> x * 63 ^ 217;
+                case 32 -> x * 65 ^ 224;
+                case 33 -> x * 67 ^ 231;
+                case 34 -> x * 69 ^ 238;
+                case 35 -> x * 71 ^ 245;
+                case 36 -> x * 73 ^ 252;
+                case 37 -> x * 75 ^ 259;
+                case 38 -> x * 77 ^ 266;
+                case 39 -> x * 79 ^ 273;
+                case 40 -> x * 81 ^ 280;
+                case 41 -> x * 83 ^ 287;
+                case 42 -> x * 85 ^ 294;
+                case 43 -> x * 87 ^ 301;
+                case 44 -> x * 89 ^ 308;
+                case 45 -> x * 91 ^ 315;
+                case 46 -> x * 93 ^ 322;
+                case 47 -> x * 95 ^ 329;
+                case 48 -> x * 97 ^ 336;
+                case 49 -> x * 99 ^ 343;
+                case 50 -> x * 101 ^ 350;
+                case 51 -> x * 103 ^ 357;
+                case 52 -> x * 105 ^ 364;
+                case 53 -> x * 107 ^ 371;
+                case 54 -> x * 109 ^ 378;
+                case 55 -> x * 111 ^ 385;
+                case 56 -> x * 113 ^ 392;
+                case 57 -> x * 115 ^ 399;
+                case 58 -> x * 117 ^ 406;
+                case 59 -> x * 119 ^ 413;
+                case 60 -> x * 121 ^ 420;
+                case 61 -> x * 123 ^ 427;
+                case 62 -> x * 125 ^ 434;
+                case 63 -> x * 127 ^ 441;
+                default -> x;
+            };
+        }
+
+        static int deepInlining(int x) {
+            return d0(x);
+        }
+
+        static int d0(int x) { return d1(x + 0) ^ (x >>> 1); }
+        static int d1(int x) { return d2(x + 1) ^ (x >>> 2); }
+        static int d2(int x) { return d3(x + 2) ^ (x >>> 3); }
+        static int d3(int x) { return d4(x + 3) ^ (x >>> 4); }
+        static int d4(int x) { return d5(x + 4) ^ (x >>> 5); }
+        static int d5(int x) { return d6(x + 5) ^ (x >>> 6); }
+        static int d6(int x) { return d7(x + 6) ^ (x >>> 7); }
+        static int d7(int x) { return d8(x + 7) ^ (x >>> 1); }
+        static int d8(int x) { return d9(x + 8) ^ (x >>> 2); }
+        static int d9(int x) { return d10(x + 9) ^ (x >>> 3); }
+        static int d10(int x) { return d11(x + 10) ^ (x >>> 4); }
+        static int d11(int x) { return d12(x + 11) ^ (x >>> 5); }
+        static int d12(int x) { return d13(x + 12) ^ (x >>> 6); }
+        static int d13(int x) { return d14(x + 13) ^ (x >>> 7); }
+        static int d14(int x) { return d15(x + 14) ^ (x >>> 1); }
+        static int d15(int x) { return d16(x + 15) ^ (x >>> 2); }
+        static int d16(int x) { return d17(x + 16) ^ (x >>> 3); }
+        static int d17(int x) { return d18(x + 17) ^ (x >>> 4); }
+        static int d18(int x) { return d19(x + 18) ^ (x >>> 5); }
+        static int d19(int x) { return d20(x + 19) ^ (x >>> 6); }
+        static int d20(int x) { return d21(x + 20) ^ (x >>> 7); }
+        static int d21(int x) { return d22(x + 21) ^ (x >>> 1); }
+        static int d22(int x) { return d23(x + 22) ^ (x >>> 2); }
+        static int d23(int x) { return d24(x + 23) ^ (x >>> 3); }
+        static int d24(int x) { return x * 31; }
+
+        static final int[] A = new int[1024];
+        static final int[] B = new int[1024];
+        static final float[] F = new float[1024];
+
+        static int loops(int x) {
+            for (int i = 0; i < A.length; i++) {
+                A[i] = B[i] * x + i;
+            }
+            for (int i = 0; i < F.length; i++) {
+                F[i] = F[i] * 0.5f + A[i];
+            }
+            int sum = 0;
+            for (int i = 0; i < A.length; i++) {
+                sum += A[i] ^ B[i];
+            }
+            for (int i = 1; i < B.length; i++) {
+                B[i] = (B[i - 1] >> 1) + A[i];
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) {
+            int result = 0;
+            for (int i = 0; i < INVOCATIONS; i++) {
+                result += switch (args[0]) {
+                    case "hugeSwitch" -> hugeSwitch(i);
+                    case "deepInlining" -> deepInlining(i);
+                    case "loops" -> loops(i);
+                    default -> throw new IllegalArgumentException(args[0]);
+                };
+            }
+            System.out.println(result);
+        }
+    }
+}
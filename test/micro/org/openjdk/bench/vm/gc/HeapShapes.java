@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.lang.ref.WeakReference;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Allocation churn against retained heap shapes that stress specific GC
+ * pause phases:
+ * <ul>
+ * <li>DENSE_CARDS: many old objects pointing to young objects, spread over
+ *     all cards of the old generation (card scanning / remembered sets).</li>
+ * <li>WEAK_REFS: a large number of live weak references with young
+ *     referents (reference processing).</li>
+ * <li>HUGE_OBJ_ARRAYS: a few very large old Object[] recording young objects
+ *     (large array scanning and work splitting).</li>
+ * <li>HUMONGOUS: churn of arrays larger than a G1 region (humongous
+ *     allocation and eager reclaim).</li>
+ * </ul>
+ *
+ * The score is the churn throughput. Pause times are best taken with
+ * {@code -prof gc}, or per phase in machine-readable form by appending
+ * {@code -XX:StartFlightRecording:filename=gc.jfr} to the JVM arguments and
+ * reading the jdk.GCPhasePause* and jdk.GCPhaseParallel events with
+ * {@code jfr print --json}.
+ */
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 2, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Benchmark)
+public abstract class HeapShapes {
+
+    public enum Shape {
+        DENSE_CARDS,
+        WEAK_REFS,
+        HUGE_OBJ_ARRAYS,
+        HUMONGOUS
+    }
+
+    @Param
+    public Shape shape;
+
+    // Number of retained old slots that are overwritten with young objects.
+    private static final int OLD_SLOTS = 4 * 1024 * 1024;
+    // Length of each huge array, about 32 MB with compressed oops.
+    private static final int HUGE_ARRAY_LENGTH = 8 * 1024 * 1024;
+    private static final int HUGE_ARRAYS = 4;
+    // Larger than the region size G1 selects for this heap size.
+    private static final int HUMONGOUS_SIZE = 4 * 1024 * 1024;
+    private static final int HUMONGOUS_RETAINED = 16;
+
+    static final class Node {
+        Object ref;
+        long payload;
+    }
+
+    private Node[] oldNodes;
+    private WeakReference<?>[] weakRefs;
+    private Object[][] hugeArrays;
+    private byte[][] humongous;
+
+    private int index;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        switch (shape) {
+            case DENSE_CARDS -> {
+                oldNodes = new Node[OLD_SLOTS];
+                for (int i = 0; i < oldNodes.length; i++) {
+                    oldNodes[i] = new Node();
+                }
+            }
+            case WEAK_REFS -> {
+                weakRefs = new WeakReference<?>[OLD_SLOTS / 4];
+                for (int i = 0; i < weakRefs.length; i++) {
+                    weakRefs[i] = new WeakReference<>(new Object());
+                }
+            }
+            case HUGE_OBJ_ARRAYS -> {
+                hugeArrays = new Object[HUGE_ARRAYS][];
+                for (int i = 0; i < hugeArrays.length; i++) {
+                    hugeArrays[i] = new Object[HUGE_ARRAY_LENGTH];
+                }
+            }
+            case HUMONGOUS -> humongous = new byte[HUMONGOUS_RETAINED][];
+        }
+        // Promote the retained shape into the old generation.
+        System.gc();
+        System.gc();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() {
+        oldNodes = null;
+        weakRefs = null;
+        hugeArrays = null;
+        humongous = null;
+    }
+
+    // Spread consecutive updates over the whole array, and thus over all cards.
+    private int nextIndex(int length) {
+        index = (index + 0x9E3779B1) & Integer.MAX_VALUE;
+        return index % length;
+    }
+
+    @Benchmark
+    public void churn(Blackhole bh) {
+        switch (shape) {
+            case DENSE_CARDS -> {
+                Node young = new Node();
+                oldNodes[nextIndex(oldNodes.length)].ref = young;
+                bh.consume(young);
+            }
+            case WEAK_REFS -> {
+                Object referent = new Object();
+                weakRefs[nextIndex(weakRefs.length)] = new WeakReference<>(referent);
+                bh.consume(referent);
+            }
+            case HUGE_OBJ_ARRAYS -> {
+                Object young = new Object();
+                int i = nextIndex(HUGE_ARRAYS * HUGE_ARRAY_LENGTH);
+                hugeArrays[i / HUGE_ARRAY_LENGTH][i % HUGE_ARRAY_LENGTH] = young;
+                bh.consume(young);
+            }
+            case HUMONGOUS -> {
+                byte[] array = new byte[HUMONGOUS_SIZE];
+                humongous[nextIndex(HUMONGOUS_RETAINED)] = array;
+                bh.consume(array);
+            }
+        }
+    }
+
+    @Fork(value = 1, jvmArgsAppend = {"-Xms2g", "-Xmx2g", "-XX:+AlwaysPreTouch", "-XX:+UseG1GC"})
+    public static class G1 extends HeapShapes {
+    }
+
+    @Fork(value = 1, jvmArgsAppend = {"-Xms2g", "-Xmx2g", "-XX:+AlwaysPreTouch", "-XX:+UseParallelGC"})
+    public static class Parallel extends HeapShapes {
+    }
+
+    @Fork(value = 1, jvmArgsAppend = {"-Xms2g", "-Xmx2g", "-XX:+AlwaysPreTouch", "-XX:+UseZGC"})
+    public static class Z extends HeapShapes {
+    }
+
+    @Fork(value = 1, jvmArgsAppend = {"-Xms2g", "-Xmx2g", "-XX:+AlwaysPreTouch", "-XX:+UseShenandoahGC"})
+    public static class Shenandoah extends HeapShapes {
+    }
+}
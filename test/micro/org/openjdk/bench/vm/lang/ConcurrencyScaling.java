@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Group;
+import org.openjdk.jmh.annotations.GroupThreads;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+import org.openjdk.jmh.infra.Control;
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Scaling benchmarks for the runtime's synchronization and thread
+ * lifecycle paths: contended monitors, wait/notify, park/unpark, virtual
+ * thread yield (freeze/thaw) and thread start/exit.
+ *
+ * Sweep the thread count with the JMH -t option (for example
+ * {@code for t in 1 2 4 8 16 32 64 128 256 512; do ... -t $t; done}). For
+ * the wait/notify and park/unpark groups -t counts the threads of whole
+ * groups. Each group pairs one waiter with one notifier (or one parker with
+ * one unparker) through a handshake, so every notify or unpark is consumed
+ * before the next one is sent and both secondary results count round trips.
+ *
+ * Internal counters that help explain scaling cliffs are available from the
+ * forked JVM with {@code -jvmArgsAppend}:
+ * {@code -Xlog:monitorinflation=info} for monitor inflation and deflation,
+ * and {@code -XX:+UnlockDiagnosticVMOptions -XX:+EnableThreadSMRStatistics
+ * -Xlog:thread+smr=info} for the ThreadsList statistics printed at exit.
+ */
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Fork(value = 3)
+@State(Scope.Benchmark)
+public class ConcurrencyScaling {
+
+    private final Object lock = new Object();
+    private long counter;
+
+    @Benchmark
+    public long contendedSynchronized() {
+        synchronized (lock) {
+            return ++counter;
+        }
+    }
+
+    @State(Scope.Group)
+    public static class WaitNotifyState {
+        final Object monitor = new Object();
+        boolean signalled;
+    }
+
+    // Both sides wait on the same monitor, so wake them with notifyAll().
+    // The waits are bounded, so that a side can notice the end of the
+    // measurement after its partner has stopped.
+
+    @Benchmark
+    @Group("waitNotify")
+    @GroupThreads(1)
+    public void waiter(WaitNotifyState s, Control control) throws InterruptedException {
+        synchronized (s.monitor) {
+            while (!s.signalled) {
+                if (control.stopMeasurement) {
+                    return;
+                }
+                s.monitor.wait(1);
+            }
+            s.signalled = false;
+            s.monitor.notifyAll();
+        }
+    }
+
+    @Benchmark
+    @Group("waitNotify")
+    @GroupThreads(1)
+    public void notifier(WaitNotifyState s, Control control) throws InterruptedException {
+        synchronized (s.monitor) {
+            while (s.signalled) {
+                if (control.stopMeasurement) {
+                    return;
+                }
+                s.monitor.wait(1);
+            }
+            s.signalled = true;
+            s.monitor.notifyAll();
+        }
+    }
+
+    @State(Scope.Group)
+    public static class ParkState {
+        volatile Thread parker;
+        volatile boolean unparked;
+    }
+
+    @Benchmark
+    @Group("parkUnpark")
+    @GroupThreads(1)
+    public void parker(ParkState s, Control control) {
+        s.parker = Thread.currentThread();
+        while (!s.unparked) {
+            if (control.stopMeasurement) {
+                return;
+            }
+            // Bounded, so the trial can end while the unparker is stopped.
+            LockSupport.parkNanos(1_000_000);
+        }
+        s.unparked = false;
+    }
+
+    @Benchmark
+    @Group("parkUnpark")
+    @GroupThreads(1)
+    public void unparker(ParkState s, Control control) {
+        // Wait until the parker has consumed the previous unpark.
+        Thread t;
+        while (s.unparked || (t = s.parker) == null) {
+            if (control.stopMeasurement) {
+                return;
+            }
+            Thread.onSpinWait();
+        }
+        s.unparked = true;
+        LockSupport.unpark(t);
+    }
+
+    private static final int YIELDS = 100;
+
+    @Benchmark
+    public void virtualThreadYield() throws InterruptedException {
+        Thread vt = Thread.ofVirtual().start(() -> {
+            for (int i = 0; i < YIELDS; i++) {
+                Thread.yield();
+            }
+        });
+        vt.join();
+    }
+
+    @Benchmark
+    public void platformThreadStartJoin(Blackhole bh) throws InterruptedException {
+        Thread t = Thread.ofPlatform().start(() -> bh.consume(Thread.currentThread()));
+        t.join();
+    }
+
+    @Benchmark
+    public void virtualThreadStartJoin(Blackhole bh) throws InterruptedException {
+        Thread t = Thread.ofVirtual().start(() -> bh.consume(Thread.currentThread()));
+        t.join();
+    }
+}